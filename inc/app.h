@@ -0,0 +1,170 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+/** @file app.h
+ ** @brief Declaraciones de funciones de la lógica de la interfaz del reloj, independiente de la placa
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "screen.h"
+#include "trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Modos de la interfaz
+typedef enum appModes {
+    APP_UNCONFIGURED,        //!< Hora no válida al iniciar el reloj
+    APP_SHOW_TIME,           //!< Muestra la hora actual
+    APP_SET_CURRENT_MINUTES, //!< Establece los minutos actuales
+    APP_SET_CURRENT_HOURS,   //!< Establece la hora actual
+    APP_SET_ALARM_MINUTES,   //!< Establece los minutos de la alarma
+    APP_SET_ALARM_HOURS,     //!< Establece la hora de la alarma
+    APP_MODES,               //!< Cantidad de modos definidos
+} appModes;
+
+//! Teclas de la interfaz, con los mismos valores que se registran con el evento TRACE_KEY
+typedef enum appKeys {
+    APP_KEY_SET_TIME = TRACE_KEY_SET_TIME,
+    APP_KEY_SET_ALARM = TRACE_KEY_SET_ALARM,
+    APP_KEY_DECREMENT = TRACE_KEY_DECREMENT,
+    APP_KEY_INCREMENT = TRACE_KEY_INCREMENT,
+    APP_KEY_ACCEPT = TRACE_KEY_ACCEPT,
+    APP_KEY_CANCEL = TRACE_KEY_CANCEL,
+    APP_KEYS, //!< Cantidad de teclas definidas
+} appKeys;
+
+typedef struct appS * appT;
+
+typedef void (*appLedT)(bool on);
+typedef void (*appDutyT)(uint8_t duty);
+typedef void (*appSoundT)(bool play);
+typedef void (*appNotifyT)(const char * event);
+typedef void (*appSaveT)(const clockStateT * state);
+
+//! Salidas de la interfaz, además de la pantalla
+typedef struct appDriverS {
+    appLedT RingingLed; //!< Enciende o apaga el indicador de la alarma sonando
+    appDutyT AlarmLed;  //!< Ciclo de trabajo del indicador de la alarma habilitada, sobre DIGITAL_PWM_MAX
+    appSoundT Sound;    //!< Inicia o detiene la melodía de la alarma
+    appNotifyT Notify;  //!< Informa un cambio de estado, por ejemplo por la consola
+    appSaveT Save;      //!< Pide guardar la configuración en memoria no volátil
+} const * appDriverT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la interfaz de un reloj sobre una pantalla.
+ *
+ * @param clock  Reloj que se muestra y configura, se crea con una función de alarma que llama a AppAlarmRinging.
+ * @param screen  Pantalla donde se dibuja la hora.
+ * @param driver  Puntero a la estructura que contiene las salidas de la interfaz.
+ * @return appT Puntero a la nueva instancia, o NULL si algún parámetro es NULL o no hay memoria.
+ *
+ * @note La interfaz no accede al hardware ni usa variables globales, por lo que se puede ejecutar en la
+ *       computadora con un reloj, una pantalla y salidas simuladas.
+ */
+appT AppCreate(clockT clock, screenT screen, appDriverT driver);
+
+/**
+ * @brief Elige el modo inicial: muestra la hora si el reloj tiene una válida, por ejemplo restaurada.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+void AppStart(appT self);
+
+/**
+ * @brief Avanza el tiempo, actualiza el brillo y dibuja la hora en la pantalla.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ * @param ticks  Cantidad de ticks del reloj transcurridos desde la llamada anterior.
+ *
+ * @note Se llama desde la interrupción del tick del sistema.
+ */
+void AppTick(appT self, uint8_t ticks);
+
+/**
+ * @brief Procesa una tecla liberada.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ * @param key  Tecla liberada.
+ */
+void AppKey(appT self, appKeys key);
+
+/**
+ * @brief Informa que la alarma comenzó a sonar, se llama desde la función de alarma del reloj.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+void AppAlarmRinging(appT self);
+
+/**
+ * @brief Informa que la configuración del reloj se modificó desde la consola.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+void AppRemoteChanged(appT self);
+
+/**
+ * @brief Informa que la hora se ajustó con una referencia externa.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+void AppTimeSynced(appT self);
+
+/**
+ * @brief Limita el brillo de la pantalla, por ejemplo según el nivel de consumo.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ * @param limit  Brillo máximo, de 0 (apagado) a SCREEN_BRIGHTNESS_MAX.
+ */
+void AppLimitBrightness(appT self, uint8_t limit);
+
+/**
+ * @brief Obtiene el modo actual de la interfaz.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ * @return appModes Modo actual, APP_UNCONFIGURED si la instancia es NULL.
+ */
+appModes AppGetMode(appT self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_H_ */
@@ -27,8 +27,13 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "console.h"
 #include "digital.h"
+#include "hibernate.h"
 #include "screen.h"
+#include "sound.h"
+#include "storage.h"
+#include "sync.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -40,7 +45,7 @@ extern "C" {
 
 /* === Public data type declarations =============================================================================== */
 typedef struct boardS {
-    digitalOutputT buzzer;
+    soundT sound;
     digitalOutputT ledRed;
     digitalOutputT ledGreen;
     digitalOutputT ledBlue;
@@ -51,7 +56,20 @@ typedef struct boardS {
     digitalInputT accept;
     digitalInputT cancel;
     screenT screen;
+    storageT storage;
+    hibernateDriverT hibernate;
+    consoleDriverT serial;
+    syncDriverT reference;
 } const * boardT;
+
+//! Mediciones del barrido del display
+typedef struct displayScanStatsS {
+    uint16_t frameRate; //!< Cuadros por segundo configurados
+    uint16_t onTime;    //!< Tiempo de encendido de cada dígito con brillo máximo, en microsegundos
+    uint32_t refreshes; //!< Cantidad de intervalos del barrido refrescados desde que se inició
+    uint64_t cycles;    //!< Ciclos del núcleo consumidos por la interrupción del barrido, incluyendo los apagados
+    uint32_t maxCycles; //!< Ciclos del núcleo consumidos por la interrupción más larga
+} displayScanStatsT;
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -60,6 +78,9 @@ typedef struct boardS {
  * @brief  Crea una nueva instancia de la placa.
  *
  * @return boardT Referencia a la nueva instancia de la placa.
+ *
+ * @note Compilada con DISPLAY_DUAL_CORE solo usa el núcleo Cortex-M0 si encuentra su programa en la flash, si no el
+ *       display y las teclas se manejan como con un solo núcleo.
  */
 boardT BoardCreate(void);
 
@@ -69,6 +90,75 @@ boardT BoardCreate(void);
  */
 void SysTickInit(uint16_t ticks);
 
+/**
+ * @brief Alarga el período del SysTick a una cantidad entera de ticks, sin perder la fracción del período en curso.
+ *
+ * @param ticks Cantidad de ticks de SysTickInit que cubre cada interrupción, uno para el funcionamiento normal.
+ * @return true Si el período entra en el contador del SysTick.
+ *
+ * @note El cambio se aplica dentro de los dos períodos siguientes. El manejador del SysTick obtiene con
+ *       SysTickElapsed la cantidad de ticks que cubre cada interrupción.
+ */
+bool SysTickSetPeriod(uint8_t ticks);
+
+/**
+ * @brief Obtiene la cantidad de ticks transcurridos desde la interrupción anterior del SysTick.
+ *
+ * @return uint8_t Ticks que cubrió el período que acaba de terminar.
+ *
+ * @note Se llama una sola vez al comienzo del manejador del SysTick, que es quien aplica los cambios de período.
+ */
+uint8_t SysTickElapsed(void);
+
+/**
+ * @brief Inicia el barrido del display con un temporizador propio, independiente del SysTick.
+ *
+ * @param frameRate Cuadros completos por segundo, cada uno enciende una vez cada dígito.
+ * @param onTime    Tiempo de encendido de cada dígito con brillo máximo, en microsegundos. Se reparte entre los
+ *                  intervalos de la modulación del brillo y el resto del turno del dígito queda apagado.
+ * @return true Si se pudo configurar el barrido.
+ */
+bool DisplayScanInit(uint16_t frameRate, uint16_t onTime);
+
+/**
+ * @brief Obtiene las mediciones del costo del barrido del display.
+ *
+ * @param stats Puntero donde se copian las mediciones.
+ */
+void DisplayScanGetStats(displayScanStatsT * stats);
+
+/**
+ * @brief Detiene o reanuda el barrido del display iniciado con DisplayScanInit, detenido el display queda apagado.
+ *
+ * @param enabled Indica si el barrido debe funcionar.
+ *
+ * @note Cuando el barrido lo hace el núcleo Cortex-M0 no hace nada, ese núcleo muestra el brillo publicado.
+ */
+void DisplayScanEnable(bool enabled);
+
+/**
+ * @brief Envía al barrido los cambios de la pantalla cuando lo hace el núcleo Cortex-M0.
+ *
+ * @note Se llama siempre desde el mismo contexto, por ejemplo al final del SysTick, porque el buzón admite un solo
+ *       productor. Cuando el barrido lo hace este núcleo no hace nada, la interrupción lee la pantalla directamente.
+ */
+void DisplayScanPublish(void);
+
+/**
+ * @brief Espera entre dos vueltas del lazo principal.
+ *
+ * @note Con un solo núcleo es una demora que filtra los rebotes de las teclas. Cuando el núcleo Cortex-M0 filtra
+ *       las teclas, este núcleo duerme hasta la próxima interrupción.
+ */
+void BoardIdle(void);
+
+/**
+ * @brief Duerme hasta la próxima interrupción, en lugar de BoardIdle cuando el lazo principal no necesita correr.
+ *
+ * @note Las teclas se leen entonces una vez por interrupción del SysTick, un período que también filtra los rebotes.
+ */
+void BoardSleep(void);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
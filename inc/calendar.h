@@ -0,0 +1,109 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CALENDAR_H_
+#define CALENDAR_H_
+
+/** @file calendar.h
+ ** @brief Declaraciones de funciones para la conversión entre fechas civiles y días desde la época
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define CALENDAR_EPOCH_YEAR 1970 //!< Año de la época, el día 0 corresponde al 1 de enero de este año
+
+/* === Public data type declarations =============================================================================== */
+
+/// @brief  Días de la semana, el día 0 de la época fue jueves.
+typedef enum calendarWeekdays {
+    CALENDAR_SUNDAY,    //!< Domingo
+    CALENDAR_MONDAY,    //!< Lunes
+    CALENDAR_TUESDAY,   //!< Martes
+    CALENDAR_WEDNESDAY, //!< Miércoles
+    CALENDAR_THURSDAY,  //!< Jueves
+    CALENDAR_FRIDAY,    //!< Viernes
+    CALENDAR_SATURDAY,  //!< Sábado
+} calendarWeekdays;
+
+typedef struct calendarDateS {
+    uint16_t year;   //!< Año, a partir de CALENDAR_EPOCH_YEAR
+    uint8_t month;   //!< Mes, de 1 a 12
+    uint8_t day;     //!< Día del mes, de 1 a 31
+    uint8_t weekday; //!< Día de la semana, ver calendarWeekdays
+} calendarDateT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Verifica si una fecha civil es válida y posterior a la época.
+ *
+ * @param date  Puntero a la fecha a verificar, el día de la semana no se tiene en cuenta.
+ * @return true Si la fecha es válida.
+ * @return false Si la fecha no es válida o el puntero es NULL.
+ */
+bool CalendarIsValid(const calendarDateT * date);
+
+/**
+ * @brief Convierte una fecha civil en la cantidad de días transcurridos desde la época.
+ *
+ * @param date  Puntero a la fecha a convertir, se asume que es válida.
+ * @return uint32_t Cantidad de días desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ */
+uint32_t CalendarToDays(const calendarDateT * date);
+
+/**
+ * @brief Convierte una cantidad de días desde la época en una fecha civil, incluyendo el día de la semana.
+ *
+ * @param days  Cantidad de días desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ * @param date  Puntero a la estructura donde se almacenará la fecha.
+ *
+ * @note La conversión se realiza en tiempo constante, sin bucles sobre años o meses.
+ */
+void CalendarFromDays(uint32_t days, calendarDateT * date);
+
+/**
+ * @brief Obtiene el día de la semana correspondiente a una cantidad de días desde la época.
+ *
+ * @param days  Cantidad de días desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ * @return uint8_t Día de la semana, ver calendarWeekdays.
+ */
+uint8_t CalendarWeekday(uint32_t days);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CALENDAR_H_ */
@@ -26,6 +26,8 @@ SPDX-License-Identifier: MIT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
+#include "calendar.h"
+#include "timezone.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -37,6 +39,12 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#define CLOCK_STATE_VALID_TIME    (1 << 0) //!< El estado guardado tiene una hora válida
+#define CLOCK_STATE_VALID_DATE    (1 << 1) //!< El estado guardado tiene una fecha válida
+#define CLOCK_STATE_VALID_ALARM   (1 << 2) //!< El estado guardado tiene una alarma válida
+#define CLOCK_STATE_ALARM_ENABLED (1 << 3) //!< El estado guardado tiene la alarma habilitada
+#define CLOCK_STATE_SNOOZED       (1 << 4) //!< Había una posposición pendiente, ClockSetState no la restaura
+
 /* === Public data type declarations =============================================================================== */
 
 /// @brief  Acciones que se pueden realizar sobre la alarma del reloj.
@@ -55,6 +63,16 @@ typedef union {
     uint8_t bcd[6];
 } clockTimeT;
 
+//! Estado del reloj que se puede guardar y restaurar, por ejemplo en memoria no volátil
+typedef struct clockStateS {
+    uint32_t days;         //!< Días transcurridos desde la época
+    uint32_t seconds;      //!< Hora local en segundos desde las 00:00:00
+    uint32_t alarmSeconds; //!< Hora de la alarma en segundos desde las 00:00:00
+    int32_t trim;          //!< Corrección de la frecuencia en partes por billón
+    uint8_t snoozeLimit;   //!< Cantidad máxima de posposiciones permitidas
+    uint8_t flags;         //!< Combinación de los indicadores CLOCK_STATE_*
+} clockStateT;
+
 typedef struct clockS * clockT;
 
 typedef void (*clockAlarmRingingT)(clockT clock);
@@ -67,7 +85,10 @@ typedef void (*clockAlarmRingingT)(clockT clock);
  * @brief Crea un reloj con la cantidad de ticks por segundo especificada.
  *
  * @param ticksPerSecond  Cantidad de ticks por segundo que tendrá el reloj.
+ * @param function  Función que se llama cuando la alarma comienza a sonar.
  * @return clockT  Retorna un puntero al reloj creado.
+ *
+ * @note Para frecuencias de ticks que no son enteras se puede usar ClockSetTickRate luego de crear el reloj.
  */
 clockT ClockCreate(uint16_t ticksPerSecond, clockAlarmRingingT function);
 
@@ -93,6 +114,116 @@ bool ClockGetTime(clockT clock, clockTimeT * currentTime);
  */
 bool ClockSetTime(clockT clock, const clockTimeT * NewTime);
 
+/**
+ * @brief Establece la fecha del reloj.
+ *
+ * @param clock  Referencia al objeto reloj donde se desea establecer la fecha.
+ * @param date  Puntero a una estructura que contiene la nueva fecha, el día de la semana se ignora.
+ * @return true
+ * @return false
+ * @note Si el puntero `date` es NULL o la fecha no es válida, la función retornará false.
+ */
+bool ClockSetDate(clockT clock, const calendarDateT * date);
+
+/**
+ * @brief Obtiene la fecha actual del reloj, incluyendo el día de la semana.
+ *
+ * @param clock  Referencia al objeto reloj del cual se desea obtener la fecha.
+ * @param date  Puntero a una estructura donde se almacenará la fecha actual.
+ * @return true
+ * @return false
+ * @note Si el puntero `date` es NULL, la función retornará false. Ademas determina si la fecha es válida. La fecha
+ *       civil se calcula solo cuando cambia el día, por lo que consultarla repetidamente no tiene costo adicional.
+ */
+bool ClockGetDate(clockT clock, calendarDateT * date);
+
+/**
+ * @brief Obtiene la cantidad de días transcurridos desde la época.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return uint32_t Cantidad de días desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ */
+uint32_t ClockGetDays(clockT clock);
+
+/**
+ * @brief Asigna la zona horaria del reloj.
+ *
+ * @param clock  Referencia al objeto reloj que se desea configurar.
+ * @param zone  Referencia a la zona horaria, o NULL para que la hora local coincida con UTC.
+ *
+ * @note La hora y fecha locales se conservan y se recalcula la hora base UTC. Los cambios de horario se aplican
+ *       automáticamente al llegar al instante de transición precalculado.
+ */
+void ClockSetTimezone(clockT clock, timezoneT zone);
+
+/**
+ * @brief Obtiene la zona horaria asignada al reloj.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return timezoneT Referencia a la zona horaria, o NULL si la hora local coincide con UTC.
+ */
+timezoneT ClockGetTimezone(clockT clock);
+
+/**
+ * @brief Obtiene la hora base del reloj en segundos UTC desde la época.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return uint32_t Segundos UTC desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ */
+uint32_t ClockGetUtc(clockT clock);
+
+/**
+ * @brief Ajusta el reloj en forma inmediata a una hora UTC, por ejemplo la recibida de una referencia externa.
+ *
+ * @param clock  Referencia al objeto reloj que se desea configurar.
+ * @param utc  Segundos UTC desde el 1 de enero de CALENDAR_EPOCH_YEAR.
+ * @return true Si se pudo ajustar el reloj.
+ *
+ * @note La hora y fecha locales se recalculan con la zona horaria y quedan válidas. La fracción de segundo acumulada
+ *       se descarta, por lo que el próximo segundo se completa un segundo después de la llamada.
+ */
+bool ClockSetUtc(clockT clock, uint32_t utc);
+
+/**
+ * @brief Obtiene la fracción del segundo en curso acumulada por los ticks.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return uint32_t Fracción de segundo en unidades de 2^-32 segundos.
+ */
+uint32_t ClockGetFraction(clockT clock);
+
+/**
+ * @brief Obtiene el desplazamiento vigente de la hora local respecto de UTC.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return int32_t Desplazamiento en segundos que se suma a la hora UTC para obtener la hora local.
+ */
+int32_t ClockGetUtcOffset(clockT clock);
+
+/**
+ * @brief Establece la frecuencia de ticks del reloj como una fracción, por ejemplo 32768/1000 Hz.
+ *
+ * @param clock  Referencia al objeto reloj que se desea configurar.
+ * @param numerator  Numerador de la frecuencia en Hz.
+ * @param denominator  Denominador de la frecuencia en Hz.
+ * @return true
+ * @return false
+ * @note Si la frecuencia es menor a un tick por segundo la función retornará false. El reloj acumula la fracción de
+ *       segundo de cada tick con 63 bits de resolución, por lo que no hay divisiones en cada tick ni deriva acumulada.
+ */
+bool ClockSetTickRate(clockT clock, uint32_t numerator, uint16_t denominator);
+
+/**
+ * @brief Corrige la frecuencia de ticks para compensar el error del oscilador.
+ *
+ * @param clock  Referencia al objeto reloj que se desea configurar.
+ * @param trim  Corrección en partes por billón (1 ppm = 1000), un valor positivo adelanta el reloj.
+ * @return true
+ * @return false
+ * @note Si la frecuencia corregida es menor a un tick por segundo la función retornará false.
+ */
+bool ClockSetTrim(clockT clock, int32_t trim);
+
 /**
  * @brief Registra un nuevo tick en el reloj.
  *
@@ -122,6 +253,42 @@ bool ClockSetAlarm(clockT clock, const clockTimeT * alarm);
  */
 bool ClockGetAlarm(clockT clock, clockTimeT * alarm);
 
+/**
+ * @brief Obtiene una copia del estado del reloj, la alarma y la configuración para poder restaurarlo luego.
+ *
+ * @param clock  Referencia al objeto reloj del cual se desea obtener el estado.
+ * @param state  Puntero a una estructura donde se almacenará el estado.
+ * @return true
+ * @return false
+ * @note Si el puntero `state` es NULL, la función retornará false.
+ */
+bool ClockGetState(clockT clock, clockStateT * state);
+
+/**
+ * @brief Restaura el estado del reloj, la alarma y la configuración obtenido con ClockGetState.
+ *
+ * @param clock  Referencia al objeto reloj que se desea restaurar.
+ * @param state  Puntero a la estructura con el estado a restaurar.
+ * @return true Si el estado se restauró y la hora restaurada es válida.
+ * @return false Si el puntero `state` es NULL, el estado no es coherente o no contiene una hora válida.
+ *
+ * @note La zona horaria no forma parte del estado y se conserva la asignada al reloj.
+ */
+bool ClockSetState(clockT clock, const clockStateT * state);
+
+/**
+ * @brief Restaura la alarma y la configuración de un estado guardado, la hora se carga pero queda sin confirmar.
+ *
+ * @param clock  Referencia al objeto reloj que se desea restaurar.
+ * @param state  Puntero a la estructura con el estado a restaurar.
+ * @return true Si el estado es coherente y se restauró.
+ * @return false Si el puntero `state` es NULL o el estado no es coherente.
+ *
+ * @note Se usa al arrancar sin alimentación previa, cuando la hora guardada está atrasada por el tiempo apagado. La
+ *       hora no avanza y la alarma no suena hasta que se configure una hora nueva.
+ */
+bool ClockRestoreSettings(clockT clock, const clockStateT * state);
+
 /**
  * @brief  Verifica si la alarma está activa en el reloj.
  *
@@ -152,9 +319,30 @@ bool ClockIsAlarmEnabled(clockT clock);
  * @brief Pospone la alarma del reloj por una cantidad de minutos especificada.
  *
  * @param clock  Referencia al objeto reloj sobre el cual se desea posponer la alarma.
- * @param minutes  Cantidad de minutos por los cuales se desea posponer la alarma.
+ * @param minutes  Cantidad de minutos, contados desde la hora actual, por los cuales se desea posponer la alarma.
+ * @return true Si la alarma fue pospuesta.
+ * @return false Si la alarma no está activa o se alcanzó el límite de posposiciones.
+ *
+ * @note La posposición se guarda por separado, por lo que la hora configurada de la alarma no se modifica y al día
+ *       siguiente la alarma vuelve a sonar a la hora original.
+ */
+bool ClockSnoozeAlarm(clockT clock, uint8_t minutes);
+
+/**
+ * @brief Establece la cantidad máxima de veces que se puede posponer la alarma cada vez que suena.
+ *
+ * @param clock  Referencia al objeto reloj que se desea configurar.
+ * @param limit  Cantidad máxima de posposiciones permitidas.
+ */
+void ClockSetSnoozeLimit(clockT clock, uint8_t limit);
+
+/**
+ * @brief Obtiene la cantidad de veces que se pospuso la alarma desde la última vez que sonó a la hora configurada.
+ *
+ * @param clock  Referencia al objeto reloj que se desea consultar.
+ * @return uint8_t Cantidad de posposiciones realizadas.
  */
-void ClockSnoozeAlarm(clockT clock, uint8_t minutes);
+uint8_t ClockGetSnoozeCount(clockT clock);
 
 /**
  * @brief  Verifica si la alarma del reloj está sonando.
@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+/** @file console.h
+ ** @brief Declaraciones de funciones para la consola de comandos y telemetría por puerto serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "keylog.h"
+#include "power.h"
+#include "sync.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+typedef struct consoleS * consoleT;
+
+typedef uint16_t (*consoleReadT)(uint8_t * data, uint16_t size);
+typedef uint16_t (*consoleWriteT)(const uint8_t * data, uint16_t size);
+typedef uint16_t (*consoleFreeT)(void);
+typedef void (*consoleChangedT)(consoleT console);
+
+typedef struct consoleDriverS {
+    consoleReadT Read;   //!< Copia los bytes recibidos disponibles sin esperar, retorna la cantidad copiada
+    consoleWriteT Write; //!< Encola bytes para transmitir sin esperar, retorna la cantidad aceptada
+    consoleFreeT Free;   //!< Retorna la cantidad de bytes que se pueden encolar sin que se descarten
+} const * consoleDriverT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una consola de comandos sobre un puerto serie.
+ *
+ * @param driver    Puntero a la estructura que contiene las funciones del driver del puerto serie.
+ * @param clock     Referencia al reloj que se consulta y configura desde la consola.
+ * @param changed   Función que se llama cuando un comando modifica la hora, la fecha, la alarma o la zona horaria.
+ *                  Puede ser NULL.
+ *
+ * @return consoleT Puntero a la nueva instancia de la consola, o NULL si falta el driver, alguna de sus funciones o
+ *                  el reloj.
+ */
+consoleT ConsoleCreate(consoleDriverT driver, clockT clock, consoleChangedT changed);
+
+/**
+ * @brief Asigna la política de consumo cuya permanencia en cada nivel se informa con el comando `stats`.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param power  Puntero a la política de consumo, o NULL para no informarla.
+ *
+ * @note La permanencia se informa en segundos, suponiendo que la política usa milisegundos como unidad de tiempo.
+ */
+void ConsoleSetPower(consoleT self, powerT power);
+
+/**
+ * @brief Asigna la sincronización cuyo desfasaje, deriva y contadores se informan con el comando `stats`.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param sync  Puntero a la sincronización con la referencia externa, o NULL para no informarla.
+ */
+void ConsoleSetSync(consoleT self, syncT sync);
+
+/**
+ * @brief Asigna el registro de teclas que se vuelca y se reproduce con el comando `keys`.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param keylog  Puntero al registro de teclas, o NULL si no se captura.
+ */
+void ConsoleSetKeylog(consoleT self, keylogT keylog);
+
+/**
+ * @brief Procesa los bytes recibidos y ejecuta los comandos completos, sin bloquear.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ *
+ * @note Los comandos se analizan de a un byte a medida que llegan, por lo que una línea puede completarse a lo largo
+ *       de varias llamadas. Los comandos disponibles son `time`, `date`, `alarm`, `stats`, `watch`, `trace`,
+ *       `keys` y `zone`. Los volcados del registro de eventos y del registro de teclas se transmiten a medida que se
+ *       libera espacio en el buffer de transmisión. La zona horaria que reemplaza `zone` se libera con
+ *       TimezoneDestroy, por lo que la zona asignada al reloj debe crearse con TimezoneCreate.
+ */
+void ConsolePoll(consoleT self);
+
+/**
+ * @brief Informa un cambio de estado, que se transmite solo si se habilitó con el comando `watch on`.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param event Texto que describe el cambio de estado.
+ */
+void ConsoleNotify(consoleT self, const char * event);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_H_ */
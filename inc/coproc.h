@@ -0,0 +1,163 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef COPROC_H_
+#define COPROC_H_
+
+/** @file coproc.h
+ ** @brief Barrido del display y filtrado de las teclas en el núcleo Cortex-M0 del LPC4337
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "mailbox.h"
+#include "screen.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef COPROC_MAILBOX_ADDRESS
+#define COPROC_MAILBOX_ADDRESS 0x2000C000 //!< Buzón en el último banco de SRAM AHB, que el enlace del M4 no usa
+#endif
+
+#ifndef COPROC_IMAGE_ADDRESS
+#define COPROC_IMAGE_ADDRESS 0x1B000000 //!< Programa del Cortex-M0, grabado al comienzo del banco B de la flash
+#endif
+
+#ifndef COPROC_IMAGE_SIZE
+#define COPROC_IMAGE_SIZE 0x80000 //!< Bytes del banco B de la flash donde debe estar el código del Cortex-M0
+#endif
+
+#ifndef COPROC_KEYS
+#define COPROC_KEYS 8 //!< Cantidad de teclas que se filtran, cada una ocupa un bit en la palabra de teclas
+#endif
+
+#ifndef COPROC_DEBOUNCE
+#define COPROC_DEBOUNCE 20 //!< Muestras consecutivas con el nuevo estado necesarias para aceptar un cambio de tecla
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Servicio del núcleo secundario que barre el display y filtra las teclas
+typedef struct coprocS * coprocT;
+
+//! Tiempos del barrido con modulación del brillo, comunes al barrido de los dos núcleos
+typedef struct coprocScanS {
+    uint32_t unit; //!< Microsegundos del intervalo de peso uno del brillo
+    uint32_t gap;  //!< Microsegundos apagados al final del turno de cada dígito, cero o al menos dos
+} coprocScanT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el servicio del núcleo secundario, que aplica a su pantalla los estados publicados en el buzón.
+ *
+ * @param mailbox   Buzón compartido con el núcleo principal, ya inicializado.
+ * @param screen    Pantalla que barre el núcleo secundario.
+ * @return coprocT Referencia al servicio o NULL si el estado de la pantalla no entra en el buzón.
+ */
+coprocT CoprocCreate(mailboxT mailbox, screenT screen);
+
+/**
+ * @brief Aplica el último estado publicado, si hay uno nuevo, y avanza el barrido de la pantalla.
+ *
+ * @param self  Referencia al servicio.
+ * @return uint8_t Peso del intervalo que comienza, como el que devuelve ScreenRefresh.
+ *
+ * @note Sin estados nuevos el costo agregado es una lectura del número de secuencia del buzón.
+ */
+uint8_t CoprocRefresh(coprocT self);
+
+/**
+ * @brief Filtra una muestra de las teclas y publica en el buzón los cambios que se mantienen.
+ *
+ * @param self  Referencia al servicio.
+ * @param raw   Teclas presionadas en la muestra, un bit por tecla.
+ * @return true Si cambió alguna tecla filtrada, para avisar al núcleo principal.
+ *
+ * @note Una tecla cambia cuando COPROC_DEBOUNCE muestras consecutivas difieren de su estado filtrado, las teclas
+ *       se filtran en forma independiente.
+ */
+bool CoprocSampleKeys(coprocT self, uint32_t raw);
+
+/**
+ * @brief Publica el estado de una pantalla en el buzón si cambió desde la última publicación, lo usa el núcleo
+ *        principal.
+ *
+ * @param mailbox   Buzón compartido con el núcleo secundario.
+ * @param screen    Pantalla del núcleo principal, que no se barre y solo guarda el estado.
+ * @param published Último estado publicado, se actualiza al publicar uno nuevo.
+ * @return true Si se publicó un estado nuevo.
+ */
+bool CoprocPublish(mailboxT mailbox, screenT screen, screenStateT * published);
+
+/**
+ * @brief Verifica que haya un programa para el núcleo secundario antes de liberarlo, lo usa el núcleo principal.
+ *
+ * @param vectors   Tabla de vectores grabada en COPROC_IMAGE_ADDRESS.
+ * @return true Si la pila inicial apunta a la RAM y el reset a código Thumb dentro del programa.
+ *
+ * @note Con la flash borrada o un programa para otro núcleo devuelve false, y el núcleo principal debe barrer el
+ *       display y leer las teclas por su cuenta.
+ */
+bool CoprocImageValid(const uint32_t vectors[]);
+
+/**
+ * @brief Calcula los tiempos del barrido de un temporizador que cuenta microsegundos.
+ *
+ * @param scan      Puntero donde se guardan los tiempos.
+ * @param frameRate Cuadros completos por segundo.
+ * @param onTime    Tiempo de encendido de cada dígito con brillo máximo, en microsegundos, se limita al turno.
+ * @param digits    Cantidad de dígitos de la pantalla.
+ * @return true Si los tiempos alcanzan para la modulación del brillo.
+ *
+ * @note El tiempo apagado de un microsegundo se descarta, porque haría coincidir las dos comparaciones del
+ *       temporizador, y el turno se acorta en ese tiempo.
+ */
+bool CoprocScanTiming(coprocScanT * scan, uint16_t frameRate, uint16_t onTime, uint8_t digits);
+
+/**
+ * @brief Calcula las comparaciones del temporizador para el intervalo que comienza al refrescar la pantalla.
+ *
+ * @param scan      Tiempos calculados con CoprocScanTiming.
+ * @param weight    Peso del intervalo, el que devuelve ScreenRefresh o CoprocRefresh.
+ * @param blank     Puntero donde se guarda la cuenta que apaga el dígito, UINT32_MAX si no se apaga antes del final.
+ * @return uint32_t Cuenta que termina el intervalo, el temporizador se reinicia al alcanzarla.
+ *
+ * @note El intervalo de mayor peso es el último del turno y se prolonga con el tiempo apagado.
+ */
+uint32_t CoprocScanSchedule(const coprocScanT * scan, uint8_t weight, uint32_t * blank);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COPROC_H_ */
@@ -0,0 +1,64 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+/** @file cycles.h
+ ** @brief Medición de tiempos de ejecución con el contador de ciclos del núcleo (DWT)
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Habilita el contador de ciclos, se llama una vez al comenzar el programa principal
+#define CYCLES_INIT()                                                                                                  \
+    do {                                                                                                               \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;                                                                \
+        DWT->CYCCNT = 0;                                                                                               \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                                                                           \
+    } while (0)
+
+//! Valor actual del contador de ciclos, la diferencia entre dos lecturas es correcta aunque el contador desborde
+#define CYCLES_NOW() (DWT->CYCCNT)
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLES_H_ */
@@ -36,6 +36,16 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#ifndef DIGITAL_PWM_CHANNELS
+#define DIGITAL_PWM_CHANNELS 8 //!< Cantidad máxima de salidas manejadas por el PWM por software
+#endif
+
+#ifndef DIGITAL_GROUP_OUTPUTS
+#define DIGITAL_GROUP_OUTPUTS 8 //!< Cantidad máxima de salidas de un grupo
+#endif
+
+#define DIGITAL_PWM_MAX 255 //!< Ciclo de trabajo de una salida siempre activa
+
 /* === Public data type declarations =============================================================================== */
 
 typedef enum digitalStates {
@@ -50,6 +60,9 @@ typedef struct digitalOutputS * digitalOutputT;
 //! Representa una entrada digital
 typedef struct digitalInputS * digitalInputT;
 
+//! Representa un grupo de salidas digitales de un mismo puerto que se escriben juntas
+typedef struct digitalOutputGroupS * digitalOutputGroupT;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -85,6 +98,78 @@ void DigitalOutputDesactivate(digitalOutputT self);
  */
 void DigitalOutputToggle(digitalOutputT self);
 
+/**
+ * @brief Crea un grupo de salidas de un mismo puerto, calculando la máscara del puerto y los niveles inactivos.
+ *
+ * @param outputs   Salidas del grupo, la posición de cada una es su bit en los valores del grupo.
+ * @param count     Cantidad de salidas, hasta DIGITAL_GROUP_OUTPUTS.
+ * @return digitalOutputGroupT Referencia al grupo o NULL si las salidas no son todas del mismo puerto.
+ */
+digitalOutputGroupT DigitalOutputGroupCreate(const digitalOutputT outputs[], uint8_t count);
+
+/**
+ * @brief Calcula el valor del puerto para un conjunto de salidas activas, para guardarlo y escribirlo luego.
+ *
+ * @param self      Referencia al grupo.
+ * @param active    Salidas activas, un bit por cada salida en el orden de creación del grupo.
+ * @return uint32_t Valor de los pines del puerto, con cada salida en su nivel activo o inactivo.
+ */
+uint32_t DigitalOutputGroupPattern(digitalOutputGroupT self, uint32_t active);
+
+/**
+ * @brief Escribe un valor calculado con DigitalOutputGroupPattern con un único acceso a los pines.
+ *
+ * Se usa el registro de puerto enmascarado, así todas las salidas cambian en el mismo instante y el resto de los
+ * pines del puerto no se modifica.
+ *
+ * @param self      Referencia al grupo.
+ * @param pattern   Valor de los pines del puerto.
+ *
+ * @note El registro de máscara es uno por puerto, los grupos de un mismo puerto se deben escribir desde un mismo
+ *       nivel de interrupción.
+ */
+void DigitalOutputGroupWrite(digitalOutputGroupT self, uint32_t pattern);
+
+/**
+ * @brief Activa las salidas indicadas del grupo y desactiva las demás en una única escritura.
+ *
+ * @param self      Referencia al grupo.
+ * @param active    Salidas activas, un bit por cada salida en el orden de creación del grupo.
+ */
+void DigitalOutputGroupSet(digitalOutputGroupT self, uint32_t active);
+
+/**
+ * @brief Inicia el PWM por software, que maneja todas las salidas con un único temporizador.
+ *
+ * @param period    Período del PWM en ticks del temporizador, al menos DIGITAL_PWM_MAX.
+ * @return true Si el período es válido.
+ *
+ * @note El temporizador debe llamar a DigitalPwmUpdate al vencer cada demora que esta devuelve, comenzando en cero.
+ *       Se llama antes de iniciar el temporizador, libera los canales asignados.
+ */
+bool DigitalPwmInit(uint32_t period);
+
+/**
+ * @brief Establece el ciclo de trabajo de una salida, que pasa a ser manejada por el PWM por software.
+ *
+ * La tabla de flancos ordenada se recalcula solo en este llamado y entra en vigencia al comenzar el período
+ * siguiente, así la interrupción se produce únicamente en los flancos y no en cada paso del PWM.
+ *
+ * @param self  Referencia a la salida digital.
+ * @param duty  Ciclo de trabajo, de 0 (inactiva) a DIGITAL_PWM_MAX (siempre activa).
+ * @return true Si la salida tiene un canal del PWM asignado.
+ *
+ * @note Una salida manejada por el PWM no se debe activar ni desactivar con las otras funciones.
+ */
+bool DigitalOutputSetDuty(digitalOutputT self, uint8_t duty);
+
+/**
+ * @brief Aplica los flancos que corresponden al instante actual, se llama desde la interrupción del temporizador.
+ *
+ * @return uint32_t Ticks del temporizador hasta el próximo flanco.
+ */
+uint32_t DigitalPwmUpdate(void);
+
 /**
  * @brief Crea un objeto de tipo digitalInputT
  *
@@ -95,6 +180,16 @@ void DigitalOutputToggle(digitalOutputT self);
  */
 digitalInputT DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted);
 
+/**
+ * @brief Crea una entrada digital que se lee de un bit de una palabra en memoria en lugar de un puerto
+ *
+ * @param word      Palabra que actualiza otro contexto, por ejemplo las teclas filtradas por el otro núcleo
+ * @param bit       Bit de la palabra que corresponde a la entrada
+ * @param inverted  Indica si la entrada es de logica invertida
+ * @return digitalInputT Referencia a la entrada digital o NULL si el bit no existe
+ */
+digitalInputT DigitalInputCreateWord(const volatile uint32_t * word, uint8_t bit, bool inverted);
+
 /**
  * @brief Permite saber si la entrada digital está activa.
  *
@@ -95,6 +95,36 @@ extern "C" {
 #define TEC_4_GPIO 1
 #define TEC_4_BIT  9
 
+#define UART_USB_TX_PORT 7
+#define UART_USB_TX_PIN  1
+#define UART_USB_TX_FUNC SCU_MODE_FUNC6
+
+#define UART_USB_RX_PORT 7
+#define UART_USB_RX_PIN  2
+#define UART_USB_RX_FUNC SCU_MODE_FUNC6
+
+#define UART_232_TX_PORT 2
+#define UART_232_TX_PIN  3
+#define UART_232_TX_FUNC SCU_MODE_FUNC2
+
+#define UART_232_RX_PORT 2
+#define UART_232_RX_PIN  4
+#define UART_232_RX_FUNC SCU_MODE_FUNC2
+
+#define SPI_MOSI_PORT 1
+#define SPI_MOSI_PIN  4
+#define SPI_MOSI_FUNC SCU_MODE_FUNC5
+
+#define SPI_SCK_PORT 0xF
+#define SPI_SCK_PIN  4
+#define SPI_SCK_FUNC SCU_MODE_FUNC0
+
+#define GPIO_0_PORT 6
+#define GPIO_0_PIN  1
+#define GPIO_0_FUNC SCU_MODE_FUNC0
+#define GPIO_0_GPIO 3
+#define GPIO_0_BIT  0
+
 /* === Public data type declarations =============================================================================== */
 
 /* === Public variable declarations ================================================================================ */
@@ -0,0 +1,98 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HIBERNATE_H_
+#define HIBERNATE_H_
+
+/** @file hibernate.h
+ ** @brief Declaraciones de funciones para conservar el estado del reloj durante el apagado profundo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define HIBERNATE_WAKE_MARGIN 2 //!< Segundos antes de la alarma en que se despierta, para que suene el reloj
+
+/* === Public data type declarations =============================================================================== */
+
+typedef uint32_t (*hibernateReadT)(uint8_t index);
+typedef void (*hibernateWriteT)(uint8_t index, uint32_t value);
+typedef uint32_t (*hibernateElapsedT)(void);
+typedef void (*hibernatePowerDownT)(uint32_t wake);
+
+typedef struct hibernateDriverS {
+    uint8_t words;                 //!< Cantidad de palabras que se conservan durante el apagado
+    hibernateReadT Read;           //!< Lee una palabra retenida
+    hibernateWriteT Write;         //!< Escribe una palabra retenida
+    hibernateElapsedT Elapsed;     //!< Segundos transcurridos desde que se llamó a PowerDown
+    hibernatePowerDownT PowerDown; //!< Programa el despertador, en segundos o cero para solo una tecla, y apaga
+} const * hibernateDriverT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Guarda el estado del reloj y el modo de la interfaz en las palabras retenidas y apaga el equipo.
+ *
+ * @param driver  Puntero a la estructura que contiene las funciones del driver de la memoria retenida.
+ * @param clock  Puntero al estado del reloj, obtenido con ClockGetState.
+ * @param mode  Modo de la interfaz que se restaura al despertar.
+ * @return true Si se guardó el estado y se llamó a PowerDown, en el equipo no retorna.
+ * @return false Si los punteros son NULL, el driver no alcanza, la alarma suena en menos de HIBERNATE_WAKE_MARGIN o
+ *               hay una posposición pendiente.
+ *
+ * @note Si la alarma está habilitada el despertador se programa HIBERNATE_WAKE_MARGIN segundos antes, de manera que
+ *       el reloj ya esté funcionando y la haga sonar normalmente. Con una posposición pendiente no se hiberna, porque
+ *       ClockSetState no la restaura al despertar.
+ */
+bool HibernateEnter(hibernateDriverT driver, const clockStateT * clock, uint8_t mode);
+
+/**
+ * @brief Recupera el estado guardado por HibernateEnter, adelantando la hora el tiempo que el equipo estuvo apagado.
+ *
+ * @param driver  Puntero a la estructura que contiene las funciones del driver de la memoria retenida.
+ * @param clock  Puntero donde se copia el estado del reloj, para restaurarlo con ClockSetState.
+ * @param mode  Puntero donde se copia el modo de la interfaz.
+ * @return true Si había un estado guardado válido.
+ * @return false Si el arranque no viene de una hibernación o el estado guardado está corrupto.
+ *
+ * @note El estado se invalida al leerlo, por lo que un reinicio posterior se trata como un arranque normal.
+ */
+bool HibernateRestore(hibernateDriverT driver, clockStateT * clock, uint8_t * mode);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIBERNATE_H_ */
@@ -0,0 +1,70 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOTPATH_H_
+#define HOTPATH_H_
+
+/** @file hotpath.h
+ ** @brief Ubicación opcional en RAM del código y las tablas que se ejecutan en cada interrupción
+ **
+ ** Las secciones elegidas comienzan con .data, por lo que el script de enlace estándar las ubica en la RAM junto con
+ ** las variables inicializadas y el código de arranque las copia desde la flash con ellas, sin cambiar el enlazado.
+ ** Después de .data no se usa un punto para que el ensamblador no les imponga los atributos de una sección de datos.
+ ** Las llamadas entre la flash y la RAM quedan fuera del alcance de un salto directo y el enlazador agrega los
+ ** trampolines necesarios.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef HOT_PATH_RAM
+#define HOT_PATH_RAM 0 //!< Ejecuta desde la RAM las funciones y tablas marcadas, sin estados de espera de la flash
+#endif
+
+#if HOT_PATH_RAM && defined(__arm__)
+//! Marca una función que se ejecuta desde la RAM, sin expandirla en llamadas que están en la flash
+#define HOT_PATH __attribute__((section(".data_ramfunc"), noinline))
+//! Marca una tabla constante que se lee desde la RAM
+#define HOT_DATA __attribute__((section(".data_hot")))
+#else
+#define HOT_PATH
+#define HOT_DATA
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOTPATH_H_ */
@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef KEYLOG_H_
+#define KEYLOG_H_
+
+/** @file keylog.h
+ ** @brief Declaraciones de funciones para capturar los cambios de las teclas y reproducirlos luego
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define KEYLOG_KEYS 7 //!< Cantidad máxima de teclas, bits 0 a 6 de la palabra de teclas
+
+/* === Public data type declarations =============================================================================== */
+
+typedef struct keylogS * keylogT;
+
+//! Cambio de una tecla
+typedef struct keylogEventS {
+    uint32_t time; //!< Instante del cambio, en milisegundos desde el inicio de la captura
+    uint8_t key;   //!< Tecla, posición de su bit en la palabra de teclas
+    bool pressed;  //!< Indica si la tecla se presionó o se soltó
+} keylogEventT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un registro de teclas vacío que comienza a capturar.
+ *
+ * @param capacity  Cantidad de entradas de 16 bits del registro, cada cambio ocupa una entrada.
+ * @return keylogT Puntero a la nueva instancia, o NULL si la capacidad es cero o no hay memoria.
+ *
+ * @note Los tiempos se cuentan desde la primera llamada a KeylogCapture.
+ */
+keylogT KeylogCreate(uint16_t capacity);
+
+/**
+ * @brief Descarta el registro y vuelve a capturar, los tiempos se cuentan desde la siguiente llamada a KeylogCapture.
+ *
+ * @param self  Puntero a la instancia del registro.
+ */
+void KeylogClear(keylogT self);
+
+/**
+ * @brief Registra las teclas que cambiaron respecto de la captura anterior.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param keys  Teclas presionadas, un bit por tecla.
+ * @param now  Instante actual, en milisegundos.
+ * @return true Si se registraron todos los cambios, false si la captura está detenida o el registro se llenó.
+ *
+ * @note Mientras se reproduce el registro no se captura, las teclas reproducidas no se vuelven a registrar. Al
+ *       reanudarse la captura el tiempo del próximo cambio se cuenta desde la primera captura posterior.
+ */
+bool KeylogCapture(keylogT self, uint32_t keys, uint32_t now);
+
+/**
+ * @brief Obtiene las entradas del registro, por ejemplo para volcarlas por la consola.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param entries  Puntero donde se almacena la dirección de la primera entrada.
+ * @return uint16_t Cantidad de entradas ocupadas.
+ */
+uint16_t KeylogGetEntries(keylogT self, const uint16_t ** entries);
+
+/**
+ * @brief Reemplaza el registro por entradas volcadas anteriormente, por ejemplo de una sesión capturada.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param entries  Entradas a cargar.
+ * @param count  Cantidad de entradas.
+ * @return true Si las entradas entran en el registro.
+ *
+ * @note La captura se detiene para no mezclar la sesión cargada con los cambios actuales, hasta KeylogClear.
+ */
+bool KeylogLoad(keylogT self, const uint16_t entries[], uint16_t count);
+
+/**
+ * @brief Decodifica el siguiente cambio de un conjunto de entradas.
+ *
+ * @param entries  Entradas del registro.
+ * @param count  Cantidad de entradas.
+ * @param cursor  Posición de la próxima entrada, comienza en cero y se avanza en cada llamada.
+ * @param time  Instante del cambio anterior, comienza en cero y se actualiza con el instante del cambio leído.
+ * @param event  Puntero donde se almacena el cambio.
+ * @return true Si se leyó un cambio, false al terminar las entradas.
+ */
+bool KeylogDecode(const uint16_t entries[], uint16_t count, uint16_t * cursor, uint32_t * time,
+                  keylogEventT * event);
+
+/**
+ * @brief Inicia la reproducción del registro, los tiempos se cuentan desde la primera llamada a KeylogReplayPoll.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param speed  Velocidad de la reproducción, 1 en tiempo real y N veces más rápido. Cero detiene la reproducción.
+ */
+void KeylogReplay(keylogT self, uint8_t speed);
+
+/**
+ * @brief Aplica a la palabra de teclas el siguiente cambio reproducido, si ya transcurrió su tiempo.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param now  Instante actual, en milisegundos.
+ * @param keys  Palabra de teclas que lee la capa de entradas, por ejemplo con DigitalInputCreateWord.
+ * @return true Mientras la reproducción está en curso.
+ *
+ * @note Se aplica como máximo un cambio en cada llamada, para que la capa de entradas detecte todos los flancos
+ *       aunque la velocidad de la reproducción sea mayor a la frecuencia de las llamadas.
+ */
+bool KeylogReplayPoll(keylogT self, uint32_t now, volatile uint32_t * keys);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEYLOG_H_ */
@@ -0,0 +1,104 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MAILBOX_H_
+#define MAILBOX_H_
+
+/** @file mailbox.h
+ ** @brief Buzón en memoria compartida entre los dos núcleos del LPC4337
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef MAILBOX_FRAME_WORDS
+#define MAILBOX_FRAME_WORDS 32 //!< Palabras del cuadro que el núcleo principal publica para el secundario
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Buzón compartido entre los núcleos, ambos lo ubican en la misma dirección de memoria.
+ *
+ * El cuadro lo escribe un único productor y lo lee un único consumidor sin bloqueos: el número de secuencia es impar
+ * mientras se escribe y el lector descarta las copias durante las que cambió, así el productor nunca espera.
+ */
+typedef struct mailboxS {
+    uint16_t frameRate;                           //!< Cuadros por segundo del barrido, se fija antes de arrancar
+    uint16_t onTime;                              //!< Microsegundos de encendido de cada dígito con brillo máximo
+    volatile uint32_t keys;                       //!< Teclas presionadas ya filtradas, un bit por tecla
+    volatile uint32_t sequence;                   //!< Número de secuencia del cuadro, impar mientras se escribe
+    volatile uint32_t frame[MAILBOX_FRAME_WORDS]; //!< Contenido del último cuadro publicado
+} * mailboxT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa el buzón, lo llama el núcleo principal antes de arrancar el secundario.
+ *
+ * @param self      Puntero al buzón compartido.
+ * @param frameRate Cuadros por segundo del barrido del display.
+ * @param onTime    Microsegundos de encendido de cada dígito con brillo máximo.
+ */
+void MailboxInit(mailboxT self, uint16_t frameRate, uint16_t onTime);
+
+/**
+ * @brief Publica un nuevo cuadro, reemplazando al anterior aunque todavía no se haya leído.
+ *
+ * @param self  Puntero al buzón compartido.
+ * @param data  Contenido del cuadro.
+ * @param size  Cantidad de bytes, hasta MAILBOX_FRAME_WORDS palabras.
+ * @return true Si el cuadro se publicó.
+ *
+ * @note Solo puede haber un productor, siempre el mismo núcleo y el mismo nivel de interrupción.
+ */
+bool MailboxPublish(mailboxT self, const void * data, uint16_t size);
+
+/**
+ * @brief Copia el último cuadro publicado si es posterior al leído anteriormente.
+ *
+ * @param self      Puntero al buzón compartido.
+ * @param data      Puntero donde se copia el cuadro.
+ * @param size      Cantidad de bytes a copiar, hasta MAILBOX_FRAME_WORDS palabras.
+ * @param sequence  Número de secuencia del último cuadro leído, se actualiza al leer uno nuevo. Comienza en cero.
+ * @return true Si se copió un cuadro nuevo y completo. Si el productor lo estaba escribiendo se devuelve false y el
+ *              contenido de data no es válido, se vuelve a intentar en la próxima llamada.
+ */
+bool MailboxFetch(mailboxT self, void * data, uint16_t size, uint32_t * sequence);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAILBOX_H_ */
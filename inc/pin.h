@@ -0,0 +1,150 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PIN_H_
+#define PIN_H_
+
+/** @file pin.h
+ ** @brief Acceso directo a pines con puerto, pin y lógica conocidos en tiempo de compilación
+ **
+ ** Complementa a las entradas y salidas de digital.h para los casos en que el pin es fijo, como los manejadores de
+ ** interrupción. Las funciones son estáticas en línea y usan los registros de byte y palabra del GPIO, así con un
+ ** descriptor constante cada acceso se reduce a una única lectura o escritura, sin objetos en el heap.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "digital.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Construye el descriptor constante de un pin, para pasarlo directamente a las funciones de este archivo
+#define PIN(port, pin, inverted) ((pinT){(port), (pin), (inverted)})
+
+/* === Public data type declarations =============================================================================== */
+
+//! Descriptor de un pin del GPIO
+typedef struct pinS {
+    uint8_t port;  //!< Puerto del GPIO
+    uint8_t pin;   //!< Pin dentro del puerto
+    bool inverted; //!< Indica si el pin es activo en nivel bajo
+} pinT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Configura el pin como salida y lo deja inactivo.
+ *
+ * @param pin   Descriptor del pin.
+ */
+static inline void PinOutputInit(const pinT pin) {
+    LPC_GPIO_PORT->B[pin.port][pin.pin] = pin.inverted;
+    LPC_GPIO_PORT->DIR[pin.port] |= 1UL << pin.pin;
+}
+
+/**
+ * @brief Configura el pin como entrada.
+ *
+ * @param pin   Descriptor del pin.
+ */
+static inline void PinInputInit(const pinT pin) {
+    LPC_GPIO_PORT->DIR[pin.port] &= ~(1UL << pin.pin);
+}
+
+/**
+ * @brief Lleva la salida al estado indicado con una escritura en el registro de byte del pin.
+ *
+ * @param pin       Descriptor del pin.
+ * @param active    Estado de la salida.
+ */
+static inline void PinWrite(const pinT pin, bool active) {
+    LPC_GPIO_PORT->B[pin.port][pin.pin] = active != pin.inverted;
+}
+
+/**
+ * @brief Activa la salida.
+ *
+ * @param pin   Descriptor del pin.
+ */
+static inline void PinActivate(const pinT pin) {
+    PinWrite(pin, true);
+}
+
+/**
+ * @brief Desactiva la salida.
+ *
+ * @param pin   Descriptor del pin.
+ */
+static inline void PinDesactivate(const pinT pin) {
+    PinWrite(pin, false);
+}
+
+/**
+ * @brief Invierte el estado de la salida con una escritura en el registro de inversión del puerto.
+ *
+ * @param pin   Descriptor del pin.
+ */
+static inline void PinToggle(const pinT pin) {
+    LPC_GPIO_PORT->NOT[pin.port] = 1UL << pin.pin;
+}
+
+/**
+ * @brief Indica si el pin está activo con una lectura del registro de palabra, que vale cero o todos unos.
+ *
+ * @param pin   Descriptor del pin.
+ * @return true Si el pin está activo.
+ */
+static inline bool PinIsActive(const pinT pin) {
+    return (LPC_GPIO_PORT->W[pin.port][pin.pin] != 0) != pin.inverted;
+}
+
+/**
+ * @brief Compara el estado del pin con el anterior para detectar flancos.
+ *
+ * @param pin   Descriptor del pin.
+ * @param last  Estado anterior, se actualiza con el estado actual.
+ * @return digitalStates Flanco detectado, como DigitalInputWasChanged.
+ */
+static inline digitalStates PinWasChanged(const pinT pin, bool * last) {
+    bool active = PinIsActive(pin);
+    digitalStates result = (digitalStates)((int)active - (int)*last);
+
+    *last = active;
+    return result;
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PIN_H_ */
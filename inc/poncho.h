@@ -183,12 +183,22 @@ extern "C" {
 #define KEY_CANCEL_GPIO 5
 #define KEY_CANCEL_BIT  8
 
+// Posición de cada tecla en la palabra de teclas que filtra el núcleo Cortex-M0
+#define KEY_F1_INDEX     0
+#define KEY_F2_INDEX     1
+#define KEY_F3_INDEX     2
+#define KEY_F4_INDEX     3
+#define KEY_ACCEPT_INDEX 4
+#define KEY_CANCEL_INDEX 5
+
 // Definiciones de los recursos asociados al zumbador
 #define BUZZER_PORT 2
 #define BUZZER_PIN 2
 #define BUZZER_FUNC SCU_MODE_FUNC4
 #define BUZZER_GPIO 5
 #define BUZZER_BIT 2
+#define BUZZER_PWM_FUNC SCU_MODE_FUNC1 //!< Función CTOUT_6 del pin, salida del SCT
+#define BUZZER_SCT_OUTPUT 6
 
 // LED RGB (activo bajo)
 
@@ -0,0 +1,122 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/** @file power.h
+ ** @brief Declaraciones de funciones para reducir el consumo según el tiempo transcurrido sin actividad del usuario
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Niveles de consumo, cada uno reduce el consumo respecto del anterior
+typedef enum powerLevels {
+    POWER_FULL,   //!< Funcionamiento normal
+    POWER_DIMMED, //!< Display con brillo reducido
+    POWER_BLANK,  //!< Display apagado
+    POWER_SLOW,   //!< Display apagado y tick del sistema más lento
+    POWER_LEVELS, //!< Cantidad de niveles definidos
+} powerLevels;
+
+typedef struct powerS * powerT;
+
+//! Estadísticas de permanencia en cada nivel
+typedef struct powerStatsS {
+    uint64_t residency[POWER_LEVELS]; //!< Tiempo total en cada nivel, en las unidades usadas en PowerPoll
+    uint32_t transitions;             //!< Cantidad de cambios de nivel
+} powerStatsT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una política de consumo que comienza en funcionamiento normal.
+ *
+ * @param timeouts  Tiempo sin actividad para pasar a cada nivel, indexado por powerLevels. El valor de POWER_FULL
+ *                  no se usa y un cero deshabilita el nivel. Se copia, no es necesario conservarlo.
+ * @param now  Instante actual, en las mismas unidades que los tiempos.
+ * @return powerT Puntero a la nueva instancia, o NULL si los tiempos son NULL o no hay memoria.
+ */
+powerT PowerCreate(const uint32_t timeouts[POWER_LEVELS], uint32_t now);
+
+/**
+ * @brief Informa actividad del usuario o de la alarma, vuelve inmediatamente al funcionamiento normal.
+ *
+ * @param self  Puntero a la instancia de la política.
+ * @param now  Instante actual.
+ * @return true Si el nivel cambió.
+ * @return false Si ya estaba en funcionamiento normal.
+ */
+bool PowerActivity(powerT self, uint32_t now);
+
+/**
+ * @brief Actualiza el nivel según el tiempo transcurrido desde la última actividad.
+ *
+ * @param self  Puntero a la instancia de la política.
+ * @param now  Instante actual.
+ * @return true Si el nivel cambió.
+ * @return false Si el nivel no cambió.
+ *
+ * @note Los instantes pueden desbordar, alcanza con consultar al menos una vez antes de que el contador dé la vuelta.
+ */
+bool PowerPoll(powerT self, uint32_t now);
+
+/**
+ * @brief Obtiene el nivel actual.
+ *
+ * @param self  Puntero a la instancia de la política.
+ * @return powerLevels Nivel actual, POWER_FULL si la instancia es NULL.
+ */
+powerLevels PowerGetLevel(powerT self);
+
+/**
+ * @brief Obtiene las estadísticas de permanencia en cada nivel.
+ *
+ * @param self  Puntero a la instancia de la política.
+ * @param stats  Puntero donde se copian las estadísticas.
+ * @return true Si se copiaron las estadísticas.
+ * @return false Si algún puntero es NULL.
+ *
+ * @note El tiempo en el nivel actual se acumula hasta la última llamada a PowerPoll o PowerActivity.
+ */
+bool PowerGetStats(powerT self, powerStatsT * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_H_ */
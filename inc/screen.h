@@ -45,18 +45,55 @@ extern "C" {
 #define SEGMENT_G  (1 << 6)
 #define SEGMENT_DP (1 << 7)
 
+//! Máscara del punto decimal de un dígito en un cuadro de cuatro dígitos, para superponerla con un OR
+#define SCREEN_FRAME_DOT(digit) ((uint32_t)SEGMENT_DP << (8 * (digit)))
+
+#ifndef SCREEN_MAX_DIGITS
+#define SCREEN_MAX_DIGITS 16 //!< Cantidad máxima de dígitos de una pantalla
+#endif
+
+#ifndef SCREEN_BRIGHTNESS_BITS
+#define SCREEN_BRIGHTNESS_BITS 3 //!< Bits del nivel de brillo, cada uno es un intervalo del turno de cada dígito
+#endif
+
+#define SCREEN_BRIGHTNESS_MAX ((1 << SCREEN_BRIGHTNESS_BITS) - 1) //!< Nivel de brillo máximo, encendido todo el turno
+
+#ifndef SCREEN_FLASH_REGIONS
+#define SCREEN_FLASH_REGIONS 2 //!< Cantidad de regiones de la pantalla que parpadean en forma independiente
+#endif
+
+#define SCREEN_FLASH_ALL 0xFF //!< Segmentos de una región que parpadea completa, SEGMENT_DP parpadea solo el punto
+
+#ifndef SCREEN_FRAME_RATE
+#define SCREEN_FRAME_RATE 250 //!< Cuadros por segundo por omisión, un dígito por cada tick de 1 ms con cuatro dígitos
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 typedef struct screenS * screenT;
 
+//! Estado de la pantalla que se puede copiar a otra instancia, por ejemplo la que barre el display en otro núcleo
+typedef struct screenStateS {
+    uint8_t value[SCREEN_MAX_DIGITS];      //!< Imagen de cada dígito
+    uint8_t dots[SCREEN_MAX_DIGITS];       //!< Puntos fijos de cada dígito
+    uint8_t brightness[SCREEN_MAX_DIGITS]; //!< Nivel de brillo de cada dígito
+    struct {
+        uint16_t digits;  //!< Dígitos de la región, un bit por dígito
+        uint16_t period;  //!< Cuadros de un ciclo completo, cero si la región no parpadea
+        uint8_t segments; //!< Segmentos que se apagan en la fase apagada
+    } flashing[SCREEN_FLASH_REGIONS];
+} screenStateT;
+
 typedef void (*digitsTurnOffT)(void);
 typedef void (*digitTurnOnT)(uint8_t);
 typedef void (*segmentsUpdatesT)(uint8_t);
+typedef void (*screenFlushT)(void);
 
 typedef struct screenDriverS {
     digitsTurnOffT DigitsTurnOff;
     segmentsUpdatesT SegmentsUpdates;
     digitTurnOnT DigitTurnOn;
+    screenFlushT Flush; //!< Opcional, envía al hardware los cambios acumulados por las funciones anteriores
 } const * screenDriverT;
 
 /* === Public variable declarations ================================================================================ */
@@ -70,6 +107,9 @@ typedef struct screenDriverS {
  * @param driver    Puntero a la estructura que contiene las funciones del driver del display.
  * 
  * @return screenT Puntero a la nueva instancia de la pantalla.
+ *
+ * @note Si se compila con SCREEN_STATIC_DRIVER definido como el nombre de un encabezado de la placa, la pantalla usa
+ *       las funciones ScreenDriver... estáticas en línea de ese encabezado y el driver recibido no se usa.
  */
 screenT ScreenCreate(uint8_t digits, screenDriverT driver);
 
@@ -83,11 +123,71 @@ screenT ScreenCreate(uint8_t digits, screenDriverT driver);
 void ScreenWriteBCD(screenT self, uint8_t * value, uint8_t size);
 
 /**
- * @brief Función para refrescar la pantalla, actualizando el dígito actual.
+ * @brief Convierte un valor HH:MM en BCD empaquetado en el cuadro de segmentos de cuatro dígitos.
+ *
+ * @param value Cuatro dígitos BCD, el primero en el nibble más significativo (por ejemplo 0x1234 para 12:34).
+ * @return uint32_t Cuadro con los segmentos del dígito i en el byte i.
+ *
+ * @note Usa una tabla de pares de dígitos, dos lecturas por cuadro. Los pares que no son BCD válido se muestran en
+ *       blanco. Los puntos se agregan con un OR de SCREEN_FRAME_DOT sobre el resultado.
+ */
+uint32_t ScreenRenderBCD(uint16_t value);
+
+/**
+ * @brief Muestra en la pantalla un cuadro de cuatro dígitos, como el que genera ScreenRenderBCD.
  *
  * @param self  Puntero a la instancia de la pantalla.
+ * @param frame Cuadro con los segmentos del dígito i en el byte i, los dígitos restantes se apagan.
  */
-void ScreenRefresh(screenT self);
+void ScreenWriteFrame(screenT self, uint32_t frame);
+
+/**
+ * @brief Función para refrescar la pantalla, avanzando al siguiente intervalo del barrido.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @return uint8_t Peso del intervalo que comienza: el próximo refresco debe llamarse luego de ese peso multiplicado
+ *                 por el tiempo de encendido del dígito dividido SCREEN_BRIGHTNESS_MAX.
+ *
+ * @note El brillo se controla con modulación por ángulo de bit: el turno de cada dígito se divide en
+ *       SCREEN_BRIGHTNESS_BITS intervalos de pesos 1, 2, 4... y el dígito se enciende en los intervalos cuyos bits
+ *       están en uno en su nivel de brillo. Así se necesitan solo log2(niveles) eventos por dígito.
+ */
+uint8_t ScreenRefresh(screenT self);
+
+/**
+ * @brief Establece el nivel de brillo de todos los dígitos.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @param level Nivel de brillo, de 0 (apagado) a SCREEN_BRIGHTNESS_MAX.
+ */
+void ScreenSetBrightness(screenT self, uint8_t level);
+
+/**
+ * @brief Establece el nivel de brillo de un dígito.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @param digit Posición del dígito.
+ * @param level Nivel de brillo, de 0 (apagado) a SCREEN_BRIGHTNESS_MAX.
+ * @return true Si el dígito existe.
+ */
+bool ScreenSetDigitBrightness(screenT self, uint8_t digit, uint8_t level);
+
+/**
+ * @brief Apaga todos los dígitos hasta el próximo refresco, para limitar el tiempo de encendido de cada dígito.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ */
+void ScreenBlank(screenT self);
+
+/**
+ * @brief Informa a la pantalla la frecuencia con la que se barren todos sus dígitos.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @param rate  Cuadros completos por segundo, cada uno con un refresco por dígito.
+ *
+ * @note La pantalla usa la frecuencia para que la velocidad del parpadeo no dependa de la velocidad del barrido.
+ */
+void ScreenSetFrameRate(screenT self, uint16_t rate);
 
 /**
  * @brief Función para parpadear los dígitos del display.
@@ -95,13 +195,56 @@ void ScreenRefresh(screenT self);
  * @param screen        Puntero al descriptor de la pantalla con la que se va a trabajar.
  * @param from          Posición del primer dígito desde el cual se comenzará a parpadear.
  * @param to            Posición del último dígito hasta el cual se parpadeará.
- * @param frecuency     Frecuencia de parpadeo en milisegundos.
+ * @param frecuency     Duración de cada fase del parpadeo, en cuadros a SCREEN_FRAME_RATE.
  * 
  * @return int Retorna 0 si la operación fue exitosa, -1 si hubo un error.
+ *
+ * @note Equivale a configurar la región 0 con ScreenFlashRegion para que parpadeen todos los segmentos.
  */
 int ScreenFlashDigits(screenT screen, uint8_t from, uint8_t to, uint16_t frecuency);
 
-void ScreenToggleDot(screenT self, uint8_t position);
+/**
+ * @brief Configura una región de dígitos que parpadea en forma independiente de las demás.
+ *
+ * @param self      Puntero a la instancia de la pantalla.
+ * @param region    Número de región, menor a SCREEN_FLASH_REGIONS.
+ * @param from      Posición del primer dígito de la región.
+ * @param to        Posición del último dígito de la región.
+ * @param segments  Segmentos que se apagan en la fase apagada: SCREEN_FLASH_ALL o SEGMENT_DP para solo el punto.
+ * @param divisor   Duración de cada fase del parpadeo, en cuadros a SCREEN_FRAME_RATE. Cero detiene el parpadeo.
+ *
+ * @return int Retorna 0 si la operación fue exitosa, -1 si hubo un error.
+ */
+int ScreenFlashRegion(screenT self, uint8_t region, uint8_t from, uint8_t to, uint8_t segments, uint16_t divisor);
+
+/**
+ * @brief Establece los puntos que se muestran fijos sobre la imagen de cada dígito.
+ *
+ * @param self      Puntero a la instancia de la pantalla.
+ * @param digits    Dígitos con el punto encendido, un bit por dígito.
+ *
+ * @note Los puntos se conservan al escribir nuevos valores y pueden parpadear con una región de solo SEGMENT_DP.
+ */
+void ScreenSetDots(screenT self, uint16_t digits);
+
+/**
+ * @brief Copia el estado de la pantalla, sin la fase del barrido ni la del parpadeo.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @param state Puntero donde se copia el estado.
+ */
+void ScreenGetState(screenT self, screenStateT * state);
+
+/**
+ * @brief Aplica un estado copiado con ScreenGetState.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ * @param state Estado a aplicar.
+ *
+ * @note Las regiones cuya configuración no cambió conservan la fase del parpadeo, así se puede aplicar el mismo
+ *       estado repetidas veces sin alterar el parpadeo. Ambas pantallas deben usar la misma frecuencia de cuadros.
+ */
+void ScreenSetState(screenT self, const screenStateT * state);
 
 /* === End of conditional blocks =================================================================================== */
 
@@ -0,0 +1,96 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCREEN_PONCHO_H_
+#define SCREEN_PONCHO_H_
+
+/** @file screen_poncho.h
+ ** @brief Driver estático del display de 7 segmentos del poncho
+ **
+ ** Define las funciones del driver como estáticas en línea. La placa las usa para armar el driver con punteros a
+ ** funciones, y al compilar con -DSCREEN_STATIC_DRIVER='"screen_poncho.h"' la pantalla las llama directamente, así el
+ ** compilador las integra en ScreenRefresh y el refresco no tiene llamadas indirectas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "pin.h"
+#include "poncho.h"
+#include "screen.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define SEGMENT_DP_OUTPUT PIN(SEGMENT_DP_GPIO, SEGMENT_DP_BIT, false) //!< Punto decimal, fuera del puerto de segmentos
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Apaga todos los dígitos y los segmentos del display.
+ */
+static inline void ScreenDriverDigitsTurnOff(void) {
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
+    PinDesactivate(SEGMENT_DP_OUTPUT);
+}
+
+/**
+ * @brief Enciende los segmentos indicados, se llama con los segmentos apagados.
+ *
+ * @param value Segmentos a encender.
+ */
+static inline void ScreenDriverSegmentsUpdates(uint8_t value) {
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, value & SEGMENTS_MASK);
+    PinWrite(SEGMENT_DP_OUTPUT, value & SEGMENT_DP);
+}
+
+/**
+ * @brief Enciende un dígito, el primero es el de la izquierda.
+ *
+ * @param digit Posición del dígito, de 0 a 3.
+ */
+static inline void ScreenDriverDigitTurnOn(uint8_t digit) {
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
+}
+
+/**
+ * @brief No hace nada, el display del poncho se escribe directamente en cada función.
+ */
+static inline void ScreenDriverFlush(void) {
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCREEN_PONCHO_H_ */
@@ -0,0 +1,81 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SHIFT_H_
+#define SHIFT_H_
+
+/** @file shift.h
+ ** @brief Declaraciones del driver de pantalla con registros de desplazamiento del tipo 74HC595
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Bytes de la cadena de registros: uno para los segmentos y uno cada ocho dígitos
+#define SHIFT_FRAME_SIZE(digits) (1 + ((digits) + 7) / 8)
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que desplaza los bytes por la cadena de registros y luego los copia a sus salidas.
+ *
+ * @param data  Bytes a desplazar, el primero termina en el registro más alejado del microcontrolador.
+ * @param size  Cantidad de bytes, uno por cada registro de la cadena.
+ *
+ * @note Los datos se pueden descartar al retornar, la función debe copiarlos si los transmite en segundo plano.
+ */
+typedef void (*shiftSendT)(const uint8_t * data, uint8_t size);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el driver de una pantalla conectada por medio de una cadena de registros de desplazamiento.
+ *
+ * El primer registro de la cadena maneja los segmentos y los siguientes los dígitos, ocho por registro, con el
+ * dígito cero en la salida QA del segundo registro. Segmentos y dígitos se activan en nivel alto. Las funciones del
+ * driver solo actualizan una copia local y el refresco de la pantalla envía una única trama por cada cambio.
+ *
+ * @param digits    Cantidad de dígitos de la pantalla, hasta SCREEN_MAX_DIGITS.
+ * @param send      Función que transmite la trama a la cadena de registros.
+ * @return screenDriverT Driver para crear la pantalla o NULL si los parámetros no son válidos.
+ *
+ * @note Las funciones del driver no reciben contexto, por eso existe una única instancia y cada llamada la reemplaza.
+ */
+screenDriverT ShiftScreenCreate(uint8_t digits, shiftSendT send);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHIFT_H_ */
@@ -0,0 +1,164 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SOUND_H_
+#define SOUND_H_
+
+/** @file sound.h
+ ** @brief Declaraciones del secuenciador de melodías para el zumbador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef SOUND_TICK
+#define SOUND_TICK 10 //!< Milisegundos de cada unidad de duración de las notas
+#endif
+
+//! Notas usadas por las melodías, con la numeración MIDI en la que el La central es 69
+#define SOUND_REST 0   //!< Silencio
+#define SOUND_A4   69  //!< La central, 440 Hz
+#define SOUND_C7   96  //!< 2093 Hz
+#define SOUND_E7   100 //!< 2637 Hz
+#define SOUND_G7   103 //!< 3136 Hz
+#define SOUND_A7   105 //!< 3520 Hz, cerca de la resonancia de los zumbadores piezoeléctricos habituales
+
+//! Construye un patrón a partir de un arreglo constante de notas
+#define SOUND_PATTERN(notes, repeats) {(notes), sizeof(notes) / sizeof((notes)[0]), (repeats)}
+
+/* === Public data type declarations =============================================================================== */
+
+//! Nota de una melodía, ocupa dos bytes para que las tablas queden en la memoria de programa
+typedef struct soundNoteS {
+    uint8_t note;     //!< Número de nota MIDI, SOUND_REST para un silencio
+    uint8_t duration; //!< Duración en unidades de SOUND_TICK, mayor a cero
+} soundNoteT;
+
+//! Secuencia de notas que se repite una cantidad de veces antes de pasar a la siguiente
+typedef struct soundPatternS {
+    const soundNoteT * notes; //!< Notas del patrón
+    uint8_t count;            //!< Cantidad de notas
+    uint8_t repeats;          //!< Repeticiones antes de pasar al patrón siguiente, cero para repetir siempre
+} soundPatternT;
+
+/**
+ * @brief Función que genera un tono en el zumbador.
+ *
+ * @param frequency Frecuencia en Hz, cero para silenciar el zumbador.
+ */
+typedef void (*soundToneT)(uint16_t frequency);
+
+/**
+ * @brief Función que programa el temporizador para llamar a SoundNext una única vez.
+ *
+ * @param delay Milisegundos hasta el llamado, cero para cancelar el llamado pendiente.
+ */
+typedef void (*soundScheduleT)(uint16_t delay);
+
+typedef struct soundDriverS {
+    soundToneT Tone;
+    soundScheduleT Schedule;
+} const * soundDriverT;
+
+typedef struct soundS * soundT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un secuenciador de melodías.
+ *
+ * @param driver    Funciones que generan los tonos y programan el temporizador.
+ * @return soundT Referencia al secuenciador creado o NULL si no se pudo crear.
+ */
+soundT SoundCreate(soundDriverT driver);
+
+/**
+ * @brief Comienza a reproducir una secuencia de patrones, reemplazando la que se estaba reproduciendo.
+ *
+ * Cada patrón se repite la cantidad de veces indicada y luego se pasa al siguiente, así una alarma puede comenzar
+ * con un aviso suave y volverse más insistente mientras nadie la atienda. La reproducción termina al completar el
+ * último patrón, salvo que este se repita siempre.
+ *
+ * @param self      Referencia al secuenciador.
+ * @param patterns  Arreglo constante de patrones, debe existir mientras se reproduce.
+ * @param count     Cantidad de patrones.
+ * @return true Si comenzó la reproducción.
+ */
+bool SoundPlay(soundT self, const soundPatternT * patterns, uint8_t count);
+
+/**
+ * @brief Detiene la reproducción y silencia el zumbador.
+ *
+ * @param self  Referencia al secuenciador.
+ */
+void SoundStop(soundT self);
+
+/**
+ * @brief Pasa a la nota siguiente, la llama el temporizador al vencer el tiempo programado.
+ *
+ * @param self  Referencia al secuenciador.
+ *
+ * @note Entre dos notas el procesador no interviene, el tono lo genera el periférico de PWM.
+ */
+void SoundNext(soundT self);
+
+/**
+ * @brief Indica si se está reproduciendo una secuencia.
+ *
+ * @param self  Referencia al secuenciador.
+ * @return true Si hay una secuencia en curso.
+ */
+bool SoundIsPlaying(soundT self);
+
+/**
+ * @brief Obtiene el patrón que se está reproduciendo, que indica cuánto escaló la alarma.
+ *
+ * @param self  Referencia al secuenciador.
+ * @return uint8_t Posición del patrón en el arreglo de SoundPlay.
+ */
+uint8_t SoundGetLevel(soundT self);
+
+/**
+ * @brief Calcula la frecuencia de una nota.
+ *
+ * @param note  Número de nota MIDI.
+ * @return uint16_t Frecuencia en Hz, cero para SOUND_REST.
+ */
+uint16_t SoundFrequency(uint8_t note);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOUND_H_ */
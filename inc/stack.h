@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef STACK_H_
+#define STACK_H_
+
+/** @file stack.h
+ ** @brief Declaraciones de funciones para medir el uso máximo de la pila y la anidación de interrupciones
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef STACK_MONITOR_ISR
+#define STACK_MONITOR_ISR 1 //!< Registra la anidación de interrupciones en los manejadores que usan STACK_ISR_ENTER
+#endif
+
+#if STACK_MONITOR_ISR
+//! Se coloca al comienzo de un manejador de interrupción
+#define STACK_ISR_ENTER() StackMonitorEnter(__builtin_frame_address(0))
+//! Se coloca al final de un manejador de interrupción
+#define STACK_ISR_EXIT() StackMonitorExit()
+#else
+#define STACK_ISR_ENTER()
+#define STACK_ISR_EXIT()
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Uso de la pila medido desde el arranque
+typedef struct stackStatsS {
+    uint32_t size;      //!< Tamaño de la región pintada en bytes
+    uint32_t used;      //!< Máxima profundidad alcanzada en bytes, por el programa principal y las interrupciones
+    uint32_t preempted; //!< Máxima profundidad del programa principal en el momento de ser interrumpido, en bytes
+    uint8_t nesting;    //!< Máxima cantidad de interrupciones anidadas
+} stackStatsT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Pinta la región libre de la pila con un patrón conocido para medir luego la profundidad alcanzada.
+ *
+ * @param bottom  Dirección más baja de la pila.
+ * @param top  Dirección siguiente a la más alta de la pila, donde comienza a crecer hacia abajo.
+ *
+ * @note Solo se pinta por debajo del puntero de pila actual, por lo que se puede llamar con la pila en uso. En el
+ *       Cortex-M el programa principal y las interrupciones comparten la pila principal (MSP): la diferencia entre
+ *       `used` y `preempted` es la porción que necesitan las interrupciones.
+ */
+void StackMonitorInit(uint32_t * bottom, uint32_t * top);
+
+/**
+ * @brief Obtiene el uso de la pila, recorriendo la región pintada hasta la primera palabra modificada.
+ *
+ * @param stats Puntero donde se copian las mediciones.
+ * @return true Si la pila fue pintada y se copiaron las mediciones.
+ */
+bool StackMonitorGet(stackStatsT * stats);
+
+/**
+ * @brief Registra la entrada a un manejador de interrupción, se usa por medio de STACK_ISR_ENTER.
+ *
+ * @param frame  Dirección del marco del manejador, aproxima el puntero de pila al entrar.
+ */
+void StackMonitorEnter(void * frame);
+
+/**
+ * @brief Registra la salida de un manejador de interrupción, se usa por medio de STACK_ISR_EXIT.
+ */
+void StackMonitorExit(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_H_ */
@@ -0,0 +1,125 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef STORAGE_H_
+#define STORAGE_H_
+
+/** @file storage.h
+ ** @brief Declaraciones de funciones para el almacenamiento no volátil con nivelación de desgaste
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define STORAGE_SLOT_SIZE    64 //!< Tamaño de cada registro del log en bytes, debe dividir al tamaño de página
+#define STORAGE_PAYLOAD_SIZE 54 //!< Cantidad máxima de bytes de datos que se guardan en cada registro
+
+/* === Public data type declarations =============================================================================== */
+
+typedef struct storageS * storageT;
+
+typedef bool (*storageReadT)(uint32_t address, void * data, uint16_t size);
+typedef bool (*storageWriteT)(uint32_t address, const void * data, uint16_t size);
+typedef bool (*storageBusyT)(void);
+
+typedef struct storageDriverS {
+    uint32_t size;       //!< Tamaño total de la memoria en bytes
+    storageReadT Read;   //!< Lee datos de la memoria
+    storageWriteT Write; //!< Inicia la escritura de datos dentro de una misma página sin esperar a que termine
+    storageBusyT Busy;   //!< Indica si la última escritura todavía está en curso
+} const * storageDriverT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una instancia del almacenamiento sobre una memoria no volátil.
+ *
+ * @param driver    Puntero a la estructura que contiene las funciones del driver de la memoria.
+ * @param holdoff   Tiempo que se espera sin nuevos cambios antes de escribir, en las unidades usadas en StoragePoll.
+ *
+ * @return storageT Puntero a la nueva instancia del almacenamiento.
+ */
+storageT StorageCreate(storageDriverT driver, uint32_t holdoff);
+
+/**
+ * @brief Recupera los datos guardados más recientes.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ * @param data  Puntero donde se copiarán los datos recuperados.
+ * @param size  Cantidad de bytes esperados, como máximo STORAGE_PAYLOAD_SIZE.
+ * @return true Si se encontró un registro válido del tamaño esperado.
+ * @return false Si no hay registros válidos.
+ *
+ * @note La búsqueda recorre una sola vez todos los registros de la memoria, por lo que el tiempo de arranque está
+ *       acotado por el tamaño de la memoria y no por la cantidad de escrituras realizadas.
+ */
+bool StorageRestore(storageT self, void * data, uint16_t size);
+
+/**
+ * @brief Solicita guardar nuevos datos, la escritura se realiza luego desde StoragePoll.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ * @param data  Puntero a los datos a guardar.
+ * @param size  Cantidad de bytes a guardar, como máximo STORAGE_PAYLOAD_SIZE.
+ * @param now   Instante actual, en las mismas unidades que el tiempo de espera.
+ * @return true Si los datos se aceptaron para ser guardados.
+ * @return false Si los datos son demasiado grandes.
+ *
+ * @note Si se solicitan varios cambios seguidos solo se escribe el último, una vez transcurrido el tiempo de espera.
+ */
+bool StorageSave(storageT self, const void * data, uint16_t size, uint32_t now);
+
+/**
+ * @brief Realiza las escrituras pendientes sin bloquear, debe llamarse periódicamente desde el lazo principal.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ * @param now   Instante actual, en las mismas unidades que el tiempo de espera.
+ * @return true Si se inició la escritura de un registro.
+ * @return false Si no había nada para escribir o todavía no corresponde hacerlo.
+ */
+bool StoragePoll(storageT self, uint32_t now);
+
+/**
+ * @brief Escribe inmediatamente los datos pendientes, esperando a que la memoria termine la operación.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ */
+void StorageFlush(storageT self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STORAGE_H_ */
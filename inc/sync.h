@@ -0,0 +1,112 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SYNC_H_
+#define SYNC_H_
+
+/** @file sync.h
+ ** @brief Declaraciones de funciones para sincronizar el reloj con una referencia de tiempo externa
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef SYNC_STEP_LIMIT
+#define SYNC_STEP_LIMIT 128 //!< Desfasaje en milisegundos a partir del cual la hora se ajusta en forma inmediata
+#endif
+
+#ifndef SYNC_MAX_TRIM
+#define SYNC_MAX_TRIM 500000 //!< Corrección máxima de frecuencia en partes por billón (500 ppm)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+typedef struct syncS * syncT;
+
+typedef uint16_t (*syncReadT)(uint8_t * data, uint16_t size);
+
+typedef struct syncDriverS {
+    syncReadT Read; //!< Copia los bytes recibidos de la referencia sin esperar, retorna la cantidad copiada
+} const * syncDriverT;
+
+//! Estadísticas de la sincronización
+typedef struct syncStatsS {
+    int32_t offset;   //!< Último desfasaje medido, en microsegundos; positivo si el reloj está atrasado
+    int32_t drift;    //!< Corrección de frecuencia estimada para el oscilador, en partes por billón
+    int32_t trim;     //!< Corrección aplicada al reloj, deriva más la corrección del desfasaje
+    uint32_t samples; //!< Cantidad de referencias aplicadas
+    uint32_t steps;   //!< Cantidad de veces que el desfasaje obligó a ajustar la hora en forma inmediata
+    uint32_t errors;  //!< Cantidad de sentencias descartadas por formato o suma de verificación inválidos
+} syncStatsT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una sincronización que lee marcas de tiempo de referencia desde un medio de transporte.
+ *
+ * @param driver  Puntero a la estructura que contiene las funciones del medio de transporte.
+ * @param clock   Referencia al reloj que se sincroniza.
+ * @return syncT Puntero a la nueva instancia de la sincronización.
+ *
+ * @note Las referencias se reciben como sentencias NMEA `RMC` o `ZDA` de cualquier emisor, por ejemplo un GPS.
+ */
+syncT SyncCreate(syncDriverT driver, clockT clock);
+
+/**
+ * @brief Procesa los bytes recibidos y aplica las referencias completas, sin bloquear.
+ *
+ * @param self  Puntero a la instancia de la sincronización.
+ * @return true Si se aplicó una nueva referencia al reloj.
+ *
+ * @note El instante de cada referencia se toma al recibir el fin de la sentencia, por lo que la demora del medio de
+ *       transporte aparece como un desfasaje constante. Si el desfasaje supera SYNC_STEP_LIMIT la hora se ajusta en
+ *       forma inmediata; si no, se corrige variando la frecuencia del reloj, sin saltos en la hora.
+ */
+bool SyncPoll(syncT self);
+
+/**
+ * @brief Obtiene las estadísticas de la sincronización.
+ *
+ * @param self  Puntero a la instancia de la sincronización.
+ * @param stats Puntero donde se copian las estadísticas.
+ * @return true Si se copiaron las estadísticas.
+ */
+bool SyncGetStats(syncT self, syncStatsT * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYNC_H_ */
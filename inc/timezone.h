@@ -0,0 +1,101 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TIMEZONE_H_
+#define TIMEZONE_H_
+
+/** @file timezone.h
+ ** @brief Declaraciones de funciones para el manejo de zonas horarias con horario de verano
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define TIMEZONE_NO_TRANSITION UINT32_MAX //!< Instante de transición cuando la zona no tiene horario de verano
+
+#define TIMEZONE_DESCRIPTION_SIZE 32 //!< Bytes máximos de la descripción de una zona, incluyendo el terminador
+
+/* === Public data type declarations =============================================================================== */
+
+typedef struct timezoneS * timezoneT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una zona horaria a partir de una descripción con el formato de la variable TZ de POSIX.
+ *
+ * @param description  Cadena con el formato `std offset [dst [offset] [,start[/time],end[/time]]]`, por ejemplo
+ *                     `ART3` o `CET-1CEST,M3.5.0,M10.5.0/3`. Las reglas solo se admiten con la forma `Mm.w.d`.
+ * @return timezoneT Referencia a la zona creada, o NULL si la descripción no es válida o no entra en
+ *         TIMEZONE_DESCRIPTION_SIZE bytes.
+ *
+ * @note Igual que en POSIX, el desplazamiento se expresa en horas al oeste de UTC, por lo que `ART3` es UTC-3.
+ */
+timezoneT TimezoneCreate(const char * description);
+
+/**
+ * @brief Libera una zona horaria creada con TimezoneCreate.
+ *
+ * @param zone  Referencia a la zona horaria, que no debe estar asignada a ningún reloj. Puede ser NULL.
+ */
+void TimezoneDestroy(timezoneT zone);
+
+/**
+ * @brief Obtiene la descripción con la que se creó la zona, para guardarla y volver a crearla luego.
+ *
+ * @param zone  Referencia a la zona horaria.
+ * @return const char* Descripción de la zona, o NULL si la referencia es NULL.
+ */
+const char * TimezoneGetDescription(timezoneT zone);
+
+/**
+ * @brief Evalúa las reglas de la zona para obtener el desplazamiento vigente y el próximo cambio de horario.
+ *
+ * @param zone  Referencia a la zona horaria.
+ * @param utc  Instante a evaluar, en segundos UTC desde la época.
+ * @param next  Puntero donde se almacena el instante UTC de la próxima transición, o TIMEZONE_NO_TRANSITION si la
+ *              zona no tiene horario de verano. Puede ser NULL.
+ * @return int32_t Desplazamiento en segundos que se suma a la hora UTC para obtener la hora local.
+ *
+ * @note Esta función evalúa las reglas, por lo que está pensada para llamarse solo al configurar el reloj o al
+ *       alcanzar el instante `next`, nunca en cada tick.
+ */
+int32_t TimezoneOffset(timezoneT zone, uint32_t utc, uint32_t * next);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEZONE_H_ */
@@ -0,0 +1,124 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/** @file trace.h
+ ** @brief Declaraciones de funciones para el registro binario de eventos en un buffer circular
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef TRACE_SIZE
+#define TRACE_SIZE 64 //!< Cantidad de registros que se conservan, debe ser potencia de dos
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Eventos que se registran
+typedef enum traceEvents {
+    TRACE_MODE,         //!< Cambio de modo, el dato es el nuevo modo
+    TRACE_KEY,          //!< Tecla liberada, el dato es un valor de traceKeys
+    TRACE_ALARM_RING,   //!< La alarma comenzó a sonar
+    TRACE_ALARM_SNOOZE, //!< La alarma se pospuso, el dato es la cantidad de posposiciones
+    TRACE_ALARM_CANCEL, //!< La alarma se canceló hasta el día siguiente
+    TRACE_ALARM_ENABLE, //!< La alarma se habilitó o deshabilitó, el dato es 1 o 0
+    TRACE_SET_TIME,     //!< Se configuró la hora, el dato es HHMM en BCD
+    TRACE_SET_ALARM,    //!< Se configuró la alarma, el dato es HHMM en BCD
+    TRACE_REMOTE,       //!< Se modificó la configuración desde la consola
+    TRACE_TICK_CYCLES,  //!< Ciclos de la interrupción más larga del SysTick, saturados a 16 bits
+    TRACE_SCAN_CYCLES,  //!< Ciclos de la interrupción más larga del barrido del display, saturados a 16 bits
+    TRACE_WAKE,         //!< Arranque desde la hibernación, el dato es el tiempo hasta iniciar el barrido en us
+    TRACE_POWER,        //!< Cambio del nivel de consumo, el dato es el nuevo nivel
+    TRACE_EVENTS,       //!< Cantidad de eventos definidos
+} traceEvents;
+
+//! Teclas que se registran con el evento TRACE_KEY
+typedef enum traceKeys {
+    TRACE_KEY_SET_TIME,
+    TRACE_KEY_SET_ALARM,
+    TRACE_KEY_DECREMENT,
+    TRACE_KEY_INCREMENT,
+    TRACE_KEY_ACCEPT,
+    TRACE_KEY_CANCEL,
+} traceKeys;
+
+//! Registro de un evento, ocho bytes sin relleno
+typedef struct traceRecordS {
+    uint32_t timestamp; //!< Instante del evento, en las unidades de la base de tiempo asignada
+    uint8_t event;      //!< Evento registrado, un valor de traceEvents
+    uint8_t reserved;   //!< Sin uso, se mantiene para alinear el dato
+    uint16_t data;      //!< Dato asociado al evento
+} traceRecordT;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Descarta los registros y asigna la base de tiempo de los nuevos registros.
+ *
+ * @param timestamp  Puntero al contador que se copia en cada registro, por ejemplo los milisegundos del SysTick.
+ */
+void TraceInit(const volatile uint32_t * timestamp);
+
+/**
+ * @brief Registra un evento, sobrescribiendo el más antiguo si el buffer está lleno.
+ *
+ * @param event  Evento a registrar.
+ * @param data  Dato asociado al evento.
+ *
+ * @note Se puede llamar desde el programa principal y desde interrupciones: la posición se reserva con un incremento
+ *       atómico y luego se escriben dos palabras, sin deshabilitar interrupciones ni dar formato.
+ */
+void TraceRecord(traceEvents event, uint16_t data);
+
+/**
+ * @brief Copia los registros posteriores a una posición, del más antiguo al más nuevo.
+ *
+ * @param cursor  Puntero a la posición del próximo registro a leer, se actualiza con los registros copiados. Si los
+ *                registros de esa posición ya se sobrescribieron se continúa desde el más antiguo disponible.
+ * @param records  Puntero donde se copian los registros.
+ * @param count  Cantidad máxima de registros a copiar.
+ * @return uint16_t Cantidad de registros copiados.
+ *
+ * @note Para leer todos los registros disponibles se comienza con el cursor en cero.
+ */
+uint16_t TraceRead(uint32_t * cursor, traceRecordT * records, uint16_t count);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_ */
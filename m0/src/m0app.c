@@ -0,0 +1,140 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file m0app.c
+ ** @brief Programa del núcleo Cortex-M0 del LPC4337, barre el display y filtra las teclas del poncho
+ **
+ ** Se compila aparte del programa principal, con CORE_M0 definido y los módulos coproc.c, mailbox.c, pin.c y
+ ** screen.c de src. El programa se graba en COPROC_IMAGE_ADDRESS y lo arranca el núcleo principal cuando la placa se
+ ** configura con DISPLAY_DUAL_CORE y encuentra su tabla de vectores.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "coproc.h"
+#include "mailbox.h"
+#include "pin.h"
+#include "poncho.h"
+#include "screen.h"
+#include "screen_poncho.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define DISPLAY_DIGITS 4 //!< Cantidad de dígitos del display del poncho
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+static void SegmentsUpdates(uint8_t value);
+static void DigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Lee el estado de las teclas del poncho.
+ *
+ * @return uint32_t Teclas presionadas, cada una en el bit indicado por su posición KEY_..._INDEX.
+ */
+static uint32_t KeysRead(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screenDriverS screenDriver = {
+    .DigitsTurnOff = DigitsTurnOff, .SegmentsUpdates = SegmentsUpdates, .DigitTurnOn = DigitTurnOn};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+    ScreenDriverDigitsTurnOff();
+}
+
+static void SegmentsUpdates(uint8_t value) {
+    ScreenDriverSegmentsUpdates(value);
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    ScreenDriverDigitTurnOn(digit);
+}
+
+static uint32_t KeysRead(void) {
+    uint32_t keys = 0;
+
+    keys |= (uint32_t)PinIsActive(PIN(KEY_F1_GPIO, KEY_F1_BIT, true)) << KEY_F1_INDEX;
+    keys |= (uint32_t)PinIsActive(PIN(KEY_F2_GPIO, KEY_F2_BIT, true)) << KEY_F2_INDEX;
+    keys |= (uint32_t)PinIsActive(PIN(KEY_F3_GPIO, KEY_F3_BIT, true)) << KEY_F3_INDEX;
+    keys |= (uint32_t)PinIsActive(PIN(KEY_F4_GPIO, KEY_F4_BIT, true)) << KEY_F4_INDEX;
+    keys |= (uint32_t)PinIsActive(PIN(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true)) << KEY_ACCEPT_INDEX;
+    keys |= (uint32_t)PinIsActive(PIN(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true)) << KEY_CANCEL_INDEX;
+    return keys;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    mailboxT mailbox = (mailboxT)COPROC_MAILBOX_ADDRESS;
+    screenT screen;
+    coprocT coproc;
+    coprocScanT scan;
+    uint32_t blank;
+    uint8_t weight;
+
+    // Los pines y el buzón los configura el núcleo principal antes de liberar el reset de este núcleo
+    screen = ScreenCreate(DISPLAY_DIGITS, &screenDriver);
+    coproc = CoprocCreate(mailbox, screen);
+    if (!coproc || !CoprocScanTiming(&scan, mailbox->frameRate, mailbox->onTime, DISPLAY_DIGITS)) {
+        while (true) {
+            __WFI(); // Sin barrido el display queda apagado
+        }
+    }
+
+    // Los mismos tiempos que el barrido del núcleo principal, pero atendidos por consulta y sin interrupciones
+    Chip_TIMER_Init(LPC_TIMER1);
+    Chip_TIMER_Disable(LPC_TIMER1);
+    Chip_TIMER_Reset(LPC_TIMER1);
+    Chip_TIMER_PrescaleSet(LPC_TIMER1, Chip_Clock_GetRate(CLK_MX_TIMER1) / 1000000 - 1);
+    Chip_TIMER_SetMatch(LPC_TIMER1, 0, 0);
+    Chip_TIMER_ResetOnMatchEnable(LPC_TIMER1, 0);
+    Chip_TIMER_SetMatch(LPC_TIMER1, 1, UINT32_MAX);
+    Chip_TIMER_Enable(LPC_TIMER1);
+
+    while (true) {
+        if (Chip_TIMER_MatchPending(LPC_TIMER1, 0)) {
+            Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+            weight = CoprocRefresh(coproc);
+            Chip_TIMER_SetMatch(LPC_TIMER1, 0, CoprocScanSchedule(&scan, weight, &blank));
+            Chip_TIMER_SetMatch(LPC_TIMER1, 1, blank);
+
+            // Las teclas se muestrean una vez por turno de dígito, cada milisegundo con los valores por omisión
+            if (weight == 1 && CoprocSampleKeys(coproc, KeysRead())) {
+                __SEV(); // Despierta al núcleo principal solo cuando cambia una tecla
+            }
+        }
+        if (Chip_TIMER_MatchPending(LPC_TIMER1, 1)) {
+            Chip_TIMER_ClearMatch(LPC_TIMER1, 1);
+            ScreenBlank(screen);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,510 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app.c
+ ** @brief Implementación de la lógica de la interfaz del reloj: modos, teclas, alarma y dibujo de la hora
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app.h"
+#include "hotpath.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define NIGHT_START      (22 * 60) //!< Minuto del día en que comienza la atenuación nocturna del display
+#define NIGHT_END        (7 * 60)  //!< Minuto del día en que termina la atenuación nocturna del display
+#define NIGHT_BRIGHTNESS 1         //!< Nivel de brillo del display durante la noche
+
+#define ALARM_LED_DUTY 24 //!< Ciclo de trabajo del LED que indica la alarma habilitada, sobre DIGITAL_PWM_MAX
+
+#define ALARM_DOT SCREEN_FRAME_DOT(3) //!< Punto que indica la alarma activada
+
+#define COLON_DIGIT   1    //!< Dígito cuyo punto separa horas y minutos
+#define COLON_REGION  1    //!< Región de parpadeo del punto que separa horas y minutos
+#define COLON_DIVISOR 125  //!< Cuadros de cada fase del parpadeo del separador, medio segundo
+#define ALARM_DOTS    0x0F //!< Puntos encendidos mientras se configura la alarma
+#define EDIT_DIVISOR  100  //!< Cuadros de cada fase del parpadeo de los dígitos que se configuran
+
+#define SNOOZE_MINUTES 5 //!< Minutos que se pospone la alarma
+
+/* === Private data type declarations ============================================================================== */
+
+struct appS {
+    clockT clock;      //!< Reloj que se muestra y configura
+    screenT screen;    //!< Pantalla donde se dibuja la hora
+    appDriverT driver; //!< Salidas de la interfaz
+    appModes mode;     //!< Modo actual
+    uint8_t digits[4]; //!< Hora que se está configurando, un dígito BCD por posición
+    uint8_t limit;     //!< Brillo máximo de la pantalla
+    bool sounding;     //!< Indica si se inició la melodía de la alarma
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Cambia el modo, informa el cambio y configura los parpadeos y puntos de la pantalla.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ * @param mode  Nuevo modo.
+ */
+static void ChangeMode(appT self, appModes mode);
+
+/**
+ * @brief Vuelve a mostrar la hora, o a esperar que se configure si el reloj no tiene una hora válida.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void ReturnToTime(appT self);
+
+/**
+ * @brief Ajusta el brillo de la pantalla según el modo, la hora y el límite asignado.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void UpdateBrightness(appT self);
+
+/**
+ * @brief Pide guardar el estado del reloj.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void SaveSettings(appT self);
+
+/**
+ * @brief Detiene la melodía de la alarma si estaba sonando.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void StopSound(appT self);
+
+/**
+ * @brief Procesa la tecla de aceptar: pospone o habilita la alarma, o avanza la configuración.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void AcceptKey(appT self);
+
+/**
+ * @brief Procesa la tecla de cancelar: cancela o deshabilita la alarma, o descarta la configuración.
+ *
+ * @param self  Puntero a la instancia de la interfaz.
+ */
+static void CancelKey(appT self);
+
+/**
+ * @brief Copia las horas y minutos de una hora en los dígitos que se configuran.
+ *
+ * @param time  Hora a copiar.
+ * @param digits  Dígitos BCD, decenas y unidades de horas y luego de minutos.
+ */
+static void GetHourMinuteBCD(const clockTimeT * time, uint8_t digits[]);
+
+/**
+ * @brief Arma una hora con segundos en cero a partir de los dígitos configurados.
+ *
+ * @param time  Hora a completar.
+ * @param digits  Dígitos BCD, decenas y unidades de horas y luego de minutos.
+ */
+static void SetHourMinuteBCD(clockTimeT * time, const uint8_t digits[]);
+
+/**
+ * @brief Obtiene el máximo valor de las unidades según las decenas.
+ *
+ * @param tens  Decenas actuales.
+ * @param max_tens  Máximo valor de las decenas, 2 para horas y 5 para minutos.
+ * @param max_units  Máximo valor de las unidades con las decenas en su máximo.
+ * @return uint8_t Máximo valor de las unidades.
+ */
+static uint8_t GetMaxUnits(uint8_t tens, uint8_t max_tens, uint8_t max_units);
+
+/**
+ * @brief Incrementa un par de dígitos BCD, volviendo a cero al superar el máximo.
+ */
+static void BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens);
+
+/**
+ * @brief Decrementa un par de dígitos BCD, pasando al máximo por debajo de cero.
+ */
+static void BcdDecrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Nombre de cada modo, tal como se informa por la consola
+static const char * const MODE_NAMES[APP_MODES] = {
+    [APP_UNCONFIGURED] = "mode unconfigured",          [APP_SHOW_TIME] = "mode show",
+    [APP_SET_CURRENT_MINUTES] = "mode set minutes",    [APP_SET_CURRENT_HOURS] = "mode set hours",
+    [APP_SET_ALARM_MINUTES] = "mode alarm minutes",    [APP_SET_ALARM_HOURS] = "mode alarm hours",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ChangeMode(appT self, appModes mode) {
+    self->mode = mode;
+    TraceRecord(TRACE_MODE, mode);
+    self->driver->Notify(MODE_NAMES[mode]);
+    UpdateBrightness(self);
+
+    ScreenSetDots(self->screen, 0);
+    ScreenFlashRegion(self->screen, COLON_REGION, COLON_DIGIT, COLON_DIGIT, SEGMENT_DP, 0);
+
+    switch (mode) {
+    case APP_UNCONFIGURED:
+        ScreenFlashDigits(self->screen, 0, 3, EDIT_DIVISOR);
+        break;
+
+    case APP_SHOW_TIME:
+        ScreenFlashDigits(self->screen, 0, 0, 0);
+        ScreenSetDots(self->screen, 1 << COLON_DIGIT);
+        ScreenFlashRegion(self->screen, COLON_REGION, COLON_DIGIT, COLON_DIGIT, SEGMENT_DP, COLON_DIVISOR);
+        break;
+
+    case APP_SET_CURRENT_MINUTES:
+        ScreenFlashDigits(self->screen, 2, 3, EDIT_DIVISOR);
+        break;
+
+    case APP_SET_CURRENT_HOURS:
+        ScreenFlashDigits(self->screen, 0, 1, EDIT_DIVISOR);
+        break;
+
+    case APP_SET_ALARM_MINUTES:
+        ScreenFlashDigits(self->screen, 2, 3, EDIT_DIVISOR);
+        ScreenSetDots(self->screen, ALARM_DOTS);
+        break;
+
+    case APP_SET_ALARM_HOURS:
+        ScreenFlashDigits(self->screen, 0, 1, EDIT_DIVISOR);
+        ScreenSetDots(self->screen, ALARM_DOTS);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void ReturnToTime(appT self) {
+    clockTimeT time;
+
+    ChangeMode(self, ClockGetTime(self->clock, &time) ? APP_SHOW_TIME : APP_UNCONFIGURED);
+}
+
+static void UpdateBrightness(appT self) {
+    clockTimeT hour;
+    uint16_t minutes;
+    uint8_t level = SCREEN_BRIGHTNESS_MAX;
+
+    // De noche se atenúa la hora en reposo, la alarma y la configuración se muestran con brillo máximo
+    if (self->mode == APP_SHOW_TIME && !ClockIsAlarmRinging(self->clock) && ClockGetTime(self->clock, &hour)) {
+        minutes = (hour.bcd[5] * 10 + hour.bcd[4]) * 60 + hour.bcd[3] * 10 + hour.bcd[2];
+        if (minutes >= NIGHT_START || minutes < NIGHT_END) {
+            level = NIGHT_BRIGHTNESS;
+        }
+    }
+    ScreenSetBrightness(self->screen, level < self->limit ? level : self->limit);
+}
+
+static void SaveSettings(appT self) {
+    clockStateT state;
+
+    if (ClockGetState(self->clock, &state)) {
+        self->driver->Save(&state);
+    }
+}
+
+static void StopSound(appT self) {
+    if (self->sounding) {
+        self->sounding = false;
+        self->driver->Sound(false);
+    }
+}
+
+static void AcceptKey(appT self) {
+    clockTimeT time;
+
+    switch (self->mode) {
+    case APP_SHOW_TIME:
+        if (ClockIsAlarmRinging(self->clock)) {
+            // Al alcanzar el límite de posposiciones la alarma sigue sonando hasta que se cancele
+            if (ClockSnoozeAlarm(self->clock, SNOOZE_MINUTES)) {
+                StopSound(self);
+                TraceRecord(TRACE_ALARM_SNOOZE, ClockGetSnoozeCount(self->clock));
+                self->driver->Notify("alarm snooze");
+            }
+        } else if (!ClockIsAlarmEnabled(self->clock)) {
+            ClockAlarmAction(self->clock, ALARM_ENABLE);
+            TraceRecord(TRACE_ALARM_ENABLE, 1);
+            self->driver->Notify("alarm on");
+            SaveSettings(self);
+        }
+        break;
+
+    case APP_SET_CURRENT_MINUTES:
+        ChangeMode(self, APP_SET_CURRENT_HOURS);
+        break;
+
+    case APP_SET_CURRENT_HOURS:
+        SetHourMinuteBCD(&time, self->digits);
+        ClockSetTime(self->clock, &time);
+        TraceRecord(TRACE_SET_TIME, self->digits[0] << 12 | self->digits[1] << 8 | self->digits[2] << 4 |
+                                        self->digits[3]);
+        SaveSettings(self);
+        ChangeMode(self, APP_SHOW_TIME);
+        break;
+
+    case APP_SET_ALARM_MINUTES:
+        ChangeMode(self, APP_SET_ALARM_HOURS);
+        break;
+
+    case APP_SET_ALARM_HOURS:
+        SetHourMinuteBCD(&time, self->digits);
+        ClockSetAlarm(self->clock, &time);
+        TraceRecord(TRACE_SET_ALARM, self->digits[0] << 12 | self->digits[1] << 8 | self->digits[2] << 4 |
+                                         self->digits[3]);
+        SaveSettings(self);
+        ReturnToTime(self); // La alarma se puede configurar antes que la hora
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void CancelKey(appT self) {
+    switch (self->mode) {
+    case APP_SHOW_TIME:
+        if (ClockIsAlarmRinging(self->clock)) {
+            ClockAlarmAction(self->clock, ALARM_CANCEL);
+            StopSound(self);
+            TraceRecord(TRACE_ALARM_CANCEL, 0);
+            self->driver->Notify("alarm cancel");
+        } else if (ClockIsAlarmEnabled(self->clock)) {
+            ClockAlarmAction(self->clock, ALARM_DISABLE);
+            TraceRecord(TRACE_ALARM_ENABLE, 0);
+            self->driver->Notify("alarm off");
+            SaveSettings(self);
+        }
+        break;
+
+    case APP_SET_CURRENT_MINUTES:
+    case APP_SET_CURRENT_HOURS:
+    case APP_SET_ALARM_MINUTES:
+    case APP_SET_ALARM_HOURS:
+        ReturnToTime(self);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void GetHourMinuteBCD(const clockTimeT * time, uint8_t digits[]) {
+    digits[0] = time->bcd[5]; // Hora de decenas
+    digits[1] = time->bcd[4]; // Hora de unidades
+    digits[2] = time->bcd[3]; // Minuto de decenas
+    digits[3] = time->bcd[2]; // Minuto de unidades
+}
+
+static void SetHourMinuteBCD(clockTimeT * time, const uint8_t digits[]) {
+    time->bcd[5] = digits[0]; // Hora de decenas
+    time->bcd[4] = digits[1]; // Hora de unidades
+    time->bcd[3] = digits[2]; // Minuto de decenas
+    time->bcd[2] = digits[3]; // Minuto de unidades
+    time->bcd[1] = 0;
+    time->bcd[0] = 0;
+}
+
+static uint8_t GetMaxUnits(uint8_t tens, uint8_t max_tens, uint8_t max_units) {
+    // Con las decenas en su máximo las horas llegan a 23, en cualquier otro caso las unidades van de 0 a 9
+    return tens == max_tens ? max_units : 9;
+}
+
+static void BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens) {
+    (*units)++;
+    if (*units > GetMaxUnits(*tens, max_tens, max_units)) {
+        *units = 0;
+        (*tens)++;
+        if (*tens > max_tens) {
+            *tens = 0;
+        }
+    }
+}
+
+static void BcdDecrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens) {
+    if (*units > 0) {
+        (*units)--;
+    } else {
+        // Debajo de cero se pasa a las decenas anteriores o al máximo, con las unidades en su máximo
+        *tens = *tens > 0 ? *tens - 1 : max_tens;
+        *units = GetMaxUnits(*tens, max_tens, max_units);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+appT AppCreate(clockT clock, screenT screen, appDriverT driver) {
+    appT self = NULL;
+
+    if (clock && screen && driver) {
+        self = malloc(sizeof(struct appS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct appS));
+        self->clock = clock;
+        self->screen = screen;
+        self->driver = driver;
+        self->mode = APP_UNCONFIGURED;
+        self->limit = SCREEN_BRIGHTNESS_MAX;
+    }
+    return self;
+}
+
+void AppStart(appT self) {
+    if (self) {
+        ReturnToTime(self);
+    }
+}
+
+HOT_PATH void AppTick(appT self, uint8_t ticks) {
+    clockTimeT hour;
+    uint32_t frame;
+
+    while (ticks--) {
+        if (ClockGetTime(self->clock, &hour) && ClockNewTick(self->clock)) {
+            UpdateBrightness(self);
+        }
+    }
+
+    if (self->mode <= APP_SHOW_TIME) {
+        ClockGetTime(self->clock, &hour);
+        frame = ScreenRenderBCD(hour.bcd[5] << 12 | hour.bcd[4] << 8 | hour.bcd[3] << 4 | hour.bcd[2]);
+        if (ClockIsAlarmActive(self->clock) && ClockIsAlarmEnabled(self->clock)) {
+            frame |= ALARM_DOT;
+            self->driver->AlarmLed(ALARM_LED_DUTY);
+        } else {
+            self->driver->AlarmLed(0);
+        }
+        ScreenWriteFrame(self->screen, frame);
+        if (!ClockIsAlarmRinging(self->clock)) {
+            self->driver->RingingLed(false);
+            StopSound(self); // La alarma se atendió desde la consola
+        }
+    }
+}
+
+void AppKey(appT self, appKeys key) {
+    clockTimeT time;
+
+    if (!self || key >= APP_KEYS) {
+        return;
+    }
+    TraceRecord(TRACE_KEY, key);
+    switch (key) {
+    case APP_KEY_ACCEPT:
+        AcceptKey(self);
+        break;
+
+    case APP_KEY_CANCEL:
+        CancelKey(self);
+        break;
+
+    case APP_KEY_SET_TIME:
+        ChangeMode(self, APP_SET_CURRENT_MINUTES);
+        ClockGetTime(self->clock, &time);
+        GetHourMinuteBCD(&time, self->digits);
+        ScreenWriteBCD(self->screen, self->digits, sizeof(self->digits));
+        break;
+
+    case APP_KEY_SET_ALARM:
+        ChangeMode(self, APP_SET_ALARM_MINUTES);
+        ClockGetAlarm(self->clock, &time);
+        GetHourMinuteBCD(&time, self->digits);
+        ScreenWriteBCD(self->screen, self->digits, sizeof(self->digits));
+        break;
+
+    case APP_KEY_DECREMENT:
+        if (self->mode == APP_SET_CURRENT_MINUTES || self->mode == APP_SET_ALARM_MINUTES) {
+            BcdDecrement(&self->digits[3], &self->digits[2], 9, 5);
+        } else if (self->mode == APP_SET_CURRENT_HOURS || self->mode == APP_SET_ALARM_HOURS) {
+            BcdDecrement(&self->digits[1], &self->digits[0], 3, 2);
+        }
+        ScreenWriteBCD(self->screen, self->digits, sizeof(self->digits));
+        break;
+
+    case APP_KEY_INCREMENT:
+        if (self->mode == APP_SET_CURRENT_MINUTES || self->mode == APP_SET_ALARM_MINUTES) {
+            BcdIncrement(&self->digits[3], &self->digits[2], 9, 5);
+        } else if (self->mode == APP_SET_CURRENT_HOURS || self->mode == APP_SET_ALARM_HOURS) {
+            BcdIncrement(&self->digits[1], &self->digits[0], 3, 2);
+        }
+        ScreenWriteBCD(self->screen, self->digits, sizeof(self->digits));
+        break;
+
+    default:
+        break;
+    }
+}
+
+void AppAlarmRinging(appT self) {
+    if (self) {
+        TraceRecord(TRACE_ALARM_RING, 0);
+        self->driver->RingingLed(true);
+        self->driver->Sound(true);
+        self->sounding = true;
+    }
+}
+
+void AppRemoteChanged(appT self) {
+    clockTimeT time;
+
+    if (self) {
+        TraceRecord(TRACE_REMOTE, 0);
+        SaveSettings(self);
+        if (self->mode == APP_UNCONFIGURED && ClockGetTime(self->clock, &time)) {
+            ChangeMode(self, APP_SHOW_TIME); // La hora se configuró desde la consola
+        }
+    }
+}
+
+void AppTimeSynced(appT self) {
+    clockTimeT time;
+
+    // La referencia externa también configura la hora si el reloj todavía no tenía una válida
+    if (self && self->mode == APP_UNCONFIGURED && ClockGetTime(self->clock, &time)) {
+        ChangeMode(self, APP_SHOW_TIME);
+    }
+}
+
+void AppLimitBrightness(appT self, uint8_t limit) {
+    if (self) {
+        self->limit = limit;
+        UpdateBrightness(self);
+    }
+}
+
+appModes AppGetMode(appT self) {
+    return self ? self->mode : APP_UNCONFIGURED;
+}
+
+/* === End of documentation ======================================================================================== */
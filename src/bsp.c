@@ -26,14 +26,86 @@ SPDX-License-Identifier: MIT
 
 #include "bsp.h"
 #include "chip.h"
+#include "console.h"
+#include "coproc.h"
+#include "cycles.h"
 #include "digital.h"
 #include "edu-ciaa.h"
+#include "hibernate.h"
+#include "hotpath.h"
+#include "mailbox.h"
+#include "pin.h"
 #include "poncho.h"
 #include "screen.h"
+#include "screen_poncho.h"
+#include "shift.h"
+#include "sound.h"
+#include "stack.h"
+#include "storage.h"
+#include "sync.h"
 #include <stdlib.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#define EEPROM_SIZE ((EEPROM_PAGE_NUM - 1) * EEPROM_PAGE_SIZE) //!< La última página de la EEPROM está reservada
+
+#ifndef STORAGE_HOLDOFF
+#define STORAGE_HOLDOFF 2000 //!< Milisegundos sin cambios antes de escribir la configuración en la EEPROM
+#endif
+
+#ifndef SERIAL_BAUDRATE
+#define SERIAL_BAUDRATE 115200 //!< Velocidad del puerto serie de la consola
+#endif
+
+#ifndef STACK_SIZE
+#define STACK_SIZE 4096 //!< Bytes de la pila principal que se pintan, por debajo del final de la RAM local
+#endif
+
+#ifndef REFERENCE_BAUDRATE
+#define REFERENCE_BAUDRATE 9600 //!< Velocidad del puerto serie del receptor GPS, la habitual de NMEA 0183
+#endif
+
+#ifndef DISPLAY_SHIFT_DIGITS
+#define DISPLAY_SHIFT_DIGITS 0 //!< Dígitos del display con registros 74HC595 en el conector SPI, cero usa el del poncho
+#endif
+
+#ifndef DISPLAY_SHIFT_BITRATE
+#define DISPLAY_SHIFT_BITRATE 8000000 //!< Bits por segundo del SSP hacia los registros de desplazamiento
+#endif
+
+#if DISPLAY_SHIFT_DIGITS
+#define DISPLAY_DIGITS DISPLAY_SHIFT_DIGITS
+#else
+#define DISPLAY_DIGITS 4 //!< Cantidad de dígitos del display del poncho
+#endif
+
+#ifndef DISPLAY_DUAL_CORE
+#define DISPLAY_DUAL_CORE 0 //!< El núcleo Cortex-M0 barre el display y filtra las teclas, el M4 duerme entre eventos
+#endif
+
+#if DISPLAY_DUAL_CORE && DISPLAY_SHIFT_DIGITS
+#error "El núcleo Cortex-M0 solo maneja el display del poncho"
+#endif
+
+#if DISPLAY_SHIFT_DIGITS && defined(SCREEN_STATIC_DRIVER)
+#error "El display con registros de desplazamiento usa el driver con punteros a funciones"
+#endif
+
+#define DISPLAY_LATCH PIN(GPIO_0_GPIO, GPIO_0_BIT, false) //!< Salida conectada a la entrada RCLK de los registros
+
+#ifndef LED_PWM_PERIOD
+#define LED_PWM_PERIOD 2550 //!< Microsegundos del período del PWM por software de los LEDs, unos 400 Hz
+#endif
+
+#define BACKUP_WORDS 64   //!< Registros de respaldo del RTC, los alimenta la batería durante el apagado profundo
+#define BACKUP_YEAR  2001 //!< Año en que se pone el RTC al hibernar, el tiempo apagado se mide con el día del año
+
+#define BUZZER_PWM_CHANNEL 1 //!< Canal de PWM del SCT que maneja la salida del zumbador
+
+#define SERIAL_RX_SIZE 128 //!< Tamaño del buffer circular de recepción, lo completa el DMA sin intervención del CPU
+#define SERIAL_TX_SIZE 256 //!< Tamaño del buffer circular de transmisión, potencia de dos
+
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
@@ -62,11 +134,231 @@ static void SegmentsUpdates(uint8_t value);
  */
 static void DigitTurnOn(uint8_t digit);
 
+/**
+ * @brief Lee un registro de respaldo del RTC.
+ *
+ * @param index Posición del registro.
+ * @return uint32_t Valor guardado.
+ */
+static uint32_t BackupRead(uint8_t index);
+
+/**
+ * @brief Escribe un registro de respaldo del RTC.
+ *
+ * @param index Posición del registro.
+ * @param value Valor a guardar.
+ */
+static void BackupWrite(uint8_t index, uint32_t value);
+
+/**
+ * @brief Calcula el tiempo que el equipo estuvo apagado a partir de la cuenta del RTC.
+ *
+ * @return uint32_t Segundos transcurridos desde que se llamó a BackupPowerDown, como máximo un año.
+ */
+static uint32_t BackupElapsed(void);
+
+/**
+ * @brief Pone en cero el RTC, programa los eventos que despiertan al equipo y entra en el apagado profundo.
+ *
+ * @param wake Segundos hasta que el RTC despierta al equipo, cero para despertar solo con una tecla.
+ *
+ * @note Las teclas del poncho están en el GPIO5, que no puede despertar al chip de este modo. La tecla que
+ *       despierta debe conectarse a la entrada WAKEUP0 del enrutador de eventos.
+ */
+static void BackupPowerDown(uint32_t wake);
+
+/**
+ * @brief Lee datos de la EEPROM interna.
+ *
+ * @param address Dirección relativa al inicio de la EEPROM.
+ * @param data Puntero donde se copian los datos leídos.
+ * @param size Cantidad de bytes a leer.
+ * @return true Siempre, la EEPROM está mapeada en memoria.
+ */
+static bool EepromRead(uint32_t address, void * data, uint16_t size);
+
+/**
+ * @brief Carga los datos en el registro de página de la EEPROM e inicia la programación sin esperar a que termine.
+ *
+ * @param address Dirección relativa al inicio de la EEPROM, alineada a palabra y dentro de una misma página.
+ * @param data Puntero a los datos a escribir, alineado a palabra.
+ * @param size Cantidad de bytes a escribir, múltiplo de cuatro.
+ * @return true Si se inició la programación.
+ */
+static bool EepromWrite(uint32_t address, const void * data, uint16_t size);
+
+/**
+ * @brief Indica si la EEPROM todavía está programando la última página escrita.
+ *
+ * @return true Si la programación está en curso.
+ */
+static bool EepromBusy(void);
+
+/**
+ * @brief Copia los bytes que el DMA recibió desde la última lectura.
+ *
+ * @param data Puntero donde se copian los datos recibidos.
+ * @param size Tamaño del buffer de destino.
+ * @return uint16_t Cantidad de bytes copiados.
+ */
+static uint16_t SerialRead(uint8_t * data, uint16_t size);
+
+/**
+ * @brief Encola bytes en el buffer de transmisión y arranca el DMA si estaba detenido.
+ *
+ * @param data Puntero a los datos a transmitir.
+ * @param size Cantidad de bytes a transmitir.
+ * @return uint16_t Cantidad de bytes aceptados, menor a size si el buffer se llenó.
+ */
+static uint16_t SerialWrite(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief Informa el espacio libre en el buffer de transmisión.
+ *
+ * @return uint16_t Cantidad de bytes que se pueden encolar.
+ */
+static uint16_t SerialFree(void);
+
+/**
+ * @brief Inicia una transferencia por DMA con el tramo contiguo pendiente del buffer de transmisión.
+ *
+ * @note Se llama con la interrupción del DMA deshabilitada o desde la misma interrupción.
+ */
+static void SerialTransmit(void);
+
+/**
+ * @brief Configura el puerto serie y los canales de DMA de la consola.
+ */
+static void SerialInit(void);
+
+/**
+ * @brief Copia los bytes que el receptor GPS envió al FIFO del puerto serie.
+ *
+ * @param data Puntero donde se copian los datos recibidos.
+ * @param size Tamaño del buffer de destino.
+ * @return uint16_t Cantidad de bytes copiados.
+ *
+ * @note A 9600 baudios llega un byte por milisegundo, el FIFO de 16 bytes alcanza si se lee en cada vuelta del lazo.
+ */
+static uint16_t ReferenceRead(uint8_t * data, uint16_t size);
+
+/**
+ * @brief Genera un tono en el zumbador con el PWM del SCT, con un ciclo de trabajo del 50%.
+ *
+ * @param frequency Frecuencia en Hz, cero para detener el PWM con la salida en bajo.
+ */
+static void BuzzerTone(uint16_t frequency);
+
+/**
+ * @brief Programa el temporizador del secuenciador para un único vencimiento.
+ *
+ * @param delay Milisegundos hasta el vencimiento, cero para detener el temporizador.
+ */
+static void BuzzerSchedule(uint16_t delay);
+
+/**
+ * @brief Configura el temporizador que avanza el PWM por software de los LEDs.
+ */
+static void LedPwmInit(void);
+
+/**
+ * @brief Configura el SCT como PWM en el pin del zumbador y el temporizador que marca el cambio de notas.
+ */
+static void BuzzerInit(void);
+
+#if DISPLAY_SHIFT_DIGITS
+/**
+ * @brief Configura el SSP, el canal de DMA y la salida del latch del display con registros de desplazamiento.
+ *
+ * @note Se llama después de SerialInit, que inicializa el controlador de DMA.
+ */
+static void DisplayShiftInit(void);
+
+/**
+ * @brief Copia una trama para los registros de desplazamiento y la transmite por DMA, o la encola si hay otra en curso.
+ *
+ * @param data  Bytes de la trama.
+ * @param size  Cantidad de bytes.
+ */
+static void DisplayShiftSend(const uint8_t * data, uint8_t size);
+
+/**
+ * @brief Inicia la transferencia por DMA de la última trama copiada.
+ *
+ * @note Se llama con la interrupción del DMA deshabilitada o desde la misma interrupción.
+ */
+static void DisplayShiftStart(void);
+#endif
+
+/**
+ * @brief Publica el estado inicial de la pantalla y arranca el núcleo Cortex-M0 que la barre.
+ *
+ * @param frameRate Cuadros completos por segundo.
+ * @param onTime    Tiempo de encendido de cada dígito con brillo máximo, en microsegundos.
+ * @return true Siempre, los tiempos los valida el programa del otro núcleo.
+ */
+static bool DisplayCoreStart(uint16_t frameRate, uint16_t onTime);
+
 /* === Private variable definitions ================================================================================ */
 
 static const struct screenDriverS screenDriver = {
     .DigitsTurnOff = DigitsTurnOff, .SegmentsUpdates = SegmentsUpdates, .DigitTurnOn = DigitTurnOn};
 
+static const struct storageDriverS storageDriver = {
+    .size = EEPROM_SIZE, .Read = EepromRead, .Write = EepromWrite, .Busy = EepromBusy};
+
+static bool eepromProgramming = false;
+
+static const struct hibernateDriverS hibernateDriver = {.words = BACKUP_WORDS,
+                                                       .Read = BackupRead,
+                                                       .Write = BackupWrite,
+                                                       .Elapsed = BackupElapsed,
+                                                       .PowerDown = BackupPowerDown};
+
+static const struct consoleDriverS serialDriver = {.Read = SerialRead, .Write = SerialWrite, .Free = SerialFree};
+
+static screenT displayScreen = NULL;        //!< Pantalla que refresca el barrido
+static volatile displayScanStatsT displayStats; //!< Mediciones del barrido, las actualiza la interrupción
+static coprocScanT displayScan;                 //!< Tiempos del barrido, los mismos que usa el núcleo Cortex-M0
+
+static uint32_t sysTickReload = 0;            //!< Ciclos del núcleo de cada tick configurado en SysTickInit
+static uint8_t sysTickRunning = 1;            //!< Ticks que dura el período en curso del SysTick
+static uint8_t sysTickLoaded = 1;             //!< Ticks del período cargado para la próxima recarga del contador
+static volatile uint8_t sysTickRequested = 1; //!< Ticks del período pedido con SysTickSetPeriod
+
+extern uint32_t _vStackTop; //!< Final de la pila principal, definido por el script de enlace
+
+static const struct syncDriverS referenceDriver = {.Read = ReferenceRead};
+
+static const struct soundDriverS buzzerDriver = {.Tone = BuzzerTone, .Schedule = BuzzerSchedule};
+
+static soundT buzzerSound = NULL; //!< Secuenciador que avanza la interrupción del temporizador
+
+static uint32_t ledPwmMatch = 0; //!< Cuenta absoluta del próximo flanco del PWM de los LEDs
+
+static uint8_t serialRx[SERIAL_RX_SIZE];
+static uint16_t serialRxTail = 0;
+static DMA_TransferDescriptor_t serialRxDescriptor; //!< Descriptor enlazado a sí mismo para recibir en forma circular
+static uint8_t serialRxChannel;
+
+static uint8_t serialTx[SERIAL_TX_SIZE];
+static volatile uint16_t serialTxHead = 0; //!< Posición donde se encola el próximo byte, la modifica SerialWrite
+static volatile uint16_t serialTxTail = 0; //!< Posición del próximo byte a transmitir, la modifica el DMA
+static volatile uint16_t serialTxPending = 0; //!< Bytes de la transferencia de DMA en curso, cero si está detenido
+static uint8_t serialTxChannel;
+
+static bool displayDualCore = false; //!< Indica si el barrido y las teclas los maneja el núcleo Cortex-M0
+static const mailboxT mailbox = (mailboxT)COPROC_MAILBOX_ADDRESS; //!< Buzón compartido con el núcleo Cortex-M0
+static screenStateT displayPublished; //!< Último estado de la pantalla publicado en el buzón
+
+#if DISPLAY_SHIFT_DIGITS
+static uint8_t displayTx[2][SHIFT_FRAME_SIZE(DISPLAY_SHIFT_DIGITS)]; //!< Una trama la lee el DMA, la otra se completa
+static uint8_t displayTxNext = 0;          //!< Buffer donde se copia la próxima trama
+static volatile bool displayTxBusy = false;   //!< Indica si hay una trama en curso
+static volatile bool displayTxQueued = false; //!< Indica si hay una trama esperando que termine la anterior
+static uint8_t displayTxChannel;
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -119,38 +411,357 @@ static void SegmentsInit(void) {
     Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
 
     Chip_SCU_PinMuxSet(SEGMENT_DP_PORT, SEGMENT_DP_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_DP_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DP_GPIO, SEGMENT_DP_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_DP_GPIO, SEGMENT_DP_BIT, true);
+    PinOutputInit(SEGMENT_DP_OUTPUT);
+}
+
+HOT_PATH static void DigitsTurnOff(void) {
+    ScreenDriverDigitsTurnOff();
 }
 
-static void DigitsTurnOff(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DP_GPIO, SEGMENT_DP_BIT, false);
+HOT_PATH static void SegmentsUpdates(uint8_t value) {
+    ScreenDriverSegmentsUpdates(value);
 }
 
-static void SegmentsUpdates(uint8_t value) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, value & SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DP_GPIO, SEGMENT_DP_BIT, (value & SEGMENT_DP));
+HOT_PATH static void DigitTurnOn(uint8_t digit) {
+    ScreenDriverDigitTurnOn(digit);
 }
 
-static void DigitTurnOn(uint8_t digit) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
+static uint32_t BackupRead(uint8_t index) {
+    return LPC_REGFILE->REGFILE[index];
+}
+
+static void BackupWrite(uint8_t index, uint32_t value) {
+    LPC_REGFILE->REGFILE[index] = value;
+}
+
+static uint32_t BackupElapsed(void) {
+    RTC_TIME_T time;
+
+    Chip_RTC_GetFullTime(LPC_RTC, &time);
+    return ((time.time[RTC_TIMETYPE_DAYOFYEAR] - 1) * 24UL + time.time[RTC_TIMETYPE_HOUR]) * 3600UL +
+           time.time[RTC_TIMETYPE_MINUTE] * 60UL + time.time[RTC_TIMETYPE_SECOND];
+}
+
+static void BackupPowerDown(uint32_t wake) {
+    RTC_TIME_T time = {0};
+
+    // El display queda apagado hasta que el equipo despierte
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    DigitsTurnOff();
+
+    // El RTC cuenta desde cero el tiempo apagado, reiniciando también el divisor para no perder una fracción
+    Chip_RTC_Init(LPC_RTC);
+    Chip_RTC_Enable(LPC_RTC, DISABLE);
+    Chip_RTC_ResetClockTickCounter(LPC_RTC);
+    time.time[RTC_TIMETYPE_DAYOFMONTH] = 1;
+    time.time[RTC_TIMETYPE_DAYOFYEAR] = 1;
+    time.time[RTC_TIMETYPE_MONTH] = 1;
+    time.time[RTC_TIMETYPE_YEAR] = BACKUP_YEAR;
+    Chip_RTC_SetFullTime(LPC_RTC, &time);
+    Chip_RTC_AlarmIntConfig(LPC_RTC, RTC_AMR_CIIR_BITMASK, DISABLE);
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+
+    Chip_EVRT_Init();
+    if (wake) {
+        time.time[RTC_TIMETYPE_SECOND] = wake % 60;
+        time.time[RTC_TIMETYPE_MINUTE] = wake / 60 % 60;
+        time.time[RTC_TIMETYPE_HOUR] = wake / 3600 % 24;
+        time.time[RTC_TIMETYPE_DAYOFYEAR] = wake / 86400 + 1;
+        Chip_RTC_SetFullAlarmTime(LPC_RTC, &time);
+        Chip_RTC_AlarmIntConfig(LPC_RTC,
+                                RTC_AMR_CIIR_IMSEC | RTC_AMR_CIIR_IMMIN | RTC_AMR_CIIR_IMHOUR | RTC_AMR_CIIR_IMDOY,
+                                ENABLE);
+        Chip_EVRT_ClrPendIntSrc(EVRT_SRC_RTC);
+        Chip_EVRT_SetUpIntSrc(EVRT_SRC_RTC, ENABLE);
+    }
+    Chip_EVRT_ConfigIO(EVRT_SRC_WAKEUP0, EVRT_SRC_ACTIVE_FALLING_EDGE);
+    Chip_EVRT_ClrPendIntSrc(EVRT_SRC_WAKEUP0);
+    Chip_EVRT_SetUpIntSrc(EVRT_SRC_WAKEUP0, ENABLE);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+
+    // Al despertar el chip se reinicia y el estado se recupera de los registros de respaldo
+    Chip_PMC_Set_PwrState(PMC_DeepPowerDown);
+    while (true) {
+    }
+}
+
+static bool EepromRead(uint32_t address, void * data, uint16_t size) {
+    memcpy(data, (const void *)(EEPROM_START + address), size);
+    return true;
+}
+
+static bool EepromWrite(uint32_t address, const void * data, uint16_t size) {
+    volatile uint32_t * destination = (volatile uint32_t *)(EEPROM_START + address);
+    const uint32_t * source = data;
+
+    // El registro de página solo admite escrituras de palabras completas
+    for (uint16_t index = 0; index < size / sizeof(uint32_t); index++) {
+        destination[index] = source[index];
+    }
+    LPC_EEPROM->INTSTATCLR = EEPROM_INT_ENDOFPROG;
+    LPC_EEPROM->CMD = EEPROM_CMD_ERASE_PRG_PAGE;
+    eepromProgramming = true;
+    return true;
+}
+
+static bool EepromBusy(void) {
+    if (eepromProgramming && (LPC_EEPROM->INTSTAT & EEPROM_INT_ENDOFPROG)) {
+        eepromProgramming = false;
+    }
+    return eepromProgramming;
+}
+
+static uint16_t SerialRead(uint8_t * data, uint16_t size) {
+    // El contador del canal indica cuántas transferencias faltan para completar la vuelta al buffer
+    uint16_t head = SERIAL_RX_SIZE - (LPC_GPDMA->CH[serialRxChannel].CONTROL & GPDMA_DMACCxControl_TransferSize(0xFFF));
+    uint16_t count = 0;
+
+    if (head >= SERIAL_RX_SIZE) {
+        head = 0;
+    }
+    while (serialRxTail != head && count < size) {
+        data[count++] = serialRx[serialRxTail];
+        serialRxTail = (serialRxTail + 1) % SERIAL_RX_SIZE;
+    }
+    return count;
+}
+
+static uint16_t SerialWrite(const uint8_t * data, uint16_t size) {
+    uint16_t count = 0;
+
+    while (count < size && ((serialTxHead + 1) & (SERIAL_TX_SIZE - 1)) != serialTxTail) {
+        serialTx[serialTxHead] = data[count++];
+        serialTxHead = (serialTxHead + 1) & (SERIAL_TX_SIZE - 1);
+    }
+
+    NVIC_DisableIRQ(DMA_IRQn);
+    if (!serialTxPending) {
+        SerialTransmit();
+    }
+    NVIC_EnableIRQ(DMA_IRQn);
+    return count;
+}
+
+static uint16_t SerialFree(void) {
+    return (serialTxTail - serialTxHead - 1) & (SERIAL_TX_SIZE - 1);
+}
+
+static void SerialTransmit(void) {
+    uint16_t head = serialTxHead;
+    uint16_t tail = serialTxTail;
+
+    // Se transmite hasta el final del buffer, el resto se envía en la transferencia siguiente
+    serialTxPending = (head >= tail) ? (head - tail) : (SERIAL_TX_SIZE - tail);
+    if (serialTxPending) {
+        Chip_GPDMA_Transfer(LPC_GPDMA, serialTxChannel, (uint32_t)&serialTx[tail], GPDMA_CONN_UART2_Tx,
+                            GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, serialTxPending);
+    }
+}
+
+static void SerialInit(void) {
+    Chip_SCU_PinMuxSet(UART_USB_TX_PORT, UART_USB_TX_PIN, SCU_MODE_PULLUP | UART_USB_TX_FUNC);
+    Chip_SCU_PinMuxSet(UART_USB_RX_PORT, UART_USB_RX_PIN, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | UART_USB_RX_FUNC);
+
+    Chip_UART_Init(LPC_USART2);
+    Chip_UART_SetBaud(LPC_USART2, SERIAL_BAUDRATE);
+    Chip_UART_ConfigData(LPC_USART2, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(LPC_USART2, UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(LPC_USART2);
+
+    Chip_GPDMA_Init(LPC_GPDMA);
+    serialRxChannel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_UART2_Rx);
+    serialTxChannel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_UART2_Tx);
+
+    // La recepción nunca termina: al completar el buffer el descriptor vuelve a cargarse a sí mismo
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &serialRxDescriptor, GPDMA_CONN_UART2_Rx, (uint32_t)serialRx,
+                              SERIAL_RX_SIZE, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, &serialRxDescriptor);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, serialRxChannel, &serialRxDescriptor, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+
+    NVIC_SetPriority(DMA_IRQn, (1 << __NVIC_PRIO_BITS) - 2);
+    NVIC_EnableIRQ(DMA_IRQn);
+}
+
+static uint16_t ReferenceRead(uint8_t * data, uint16_t size) {
+    uint16_t count = 0;
+
+    while (count < size && (Chip_UART_ReadLineStatus(LPC_USART3) & UART_LSR_RDR)) {
+        data[count++] = Chip_UART_ReadByte(LPC_USART3);
+    }
+    return count;
+}
+
+static void LedPwmInit(void) {
+    // El temporizador cuenta microsegundos sin reiniciarse, cada flanco se programa sumando la demora al anterior
+    Chip_TIMER_Init(LPC_TIMER3);
+    Chip_TIMER_Disable(LPC_TIMER3);
+    Chip_TIMER_Reset(LPC_TIMER3);
+    Chip_TIMER_PrescaleSet(LPC_TIMER3, Chip_Clock_GetRate(CLK_MX_TIMER3) / 1000000 - 1);
+    ledPwmMatch = 1;
+    Chip_TIMER_SetMatch(LPC_TIMER3, 0, ledPwmMatch);
+    Chip_TIMER_ResetOnMatchDisable(LPC_TIMER3, 0);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER3, 0);
+    DigitalPwmInit(LED_PWM_PERIOD);
+
+    NVIC_SetPriority(TIMER3_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    NVIC_ClearPendingIRQ(TIMER3_IRQn);
+    NVIC_EnableIRQ(TIMER3_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER3);
+}
+
+static void BuzzerTone(uint16_t frequency) {
+    Chip_SCTPWM_Stop(LPC_SCT);
+    if (frequency) {
+        Chip_SCTPWM_SetRate(LPC_SCT, frequency);
+        Chip_SCTPWM_SetDutyCycle(LPC_SCT, BUZZER_PWM_CHANNEL, Chip_SCTPWM_GetTicksPerCycle(LPC_SCT) / 2);
+        Chip_SCTPWM_Start(LPC_SCT);
+    } else {
+        // La salida solo se puede escribir con el contador detenido, así el zumbador no queda con corriente continua
+        LPC_SCT->OUTPUT &= ~(1 << BUZZER_SCT_OUTPUT);
+    }
+}
+
+static void BuzzerSchedule(uint16_t delay) {
+    Chip_TIMER_Disable(LPC_TIMER2);
+    Chip_TIMER_Reset(LPC_TIMER2);
+    Chip_TIMER_ClearMatch(LPC_TIMER2, 0);
+    if (delay) {
+        Chip_TIMER_SetMatch(LPC_TIMER2, 0, delay);
+        Chip_TIMER_Enable(LPC_TIMER2);
+    }
+}
+
+static void BuzzerInit(void) {
+    Chip_SCU_PinMuxSet(BUZZER_PORT, BUZZER_PIN, SCU_MODE_INACT | BUZZER_PWM_FUNC);
+    Chip_SCTPWM_Init(LPC_SCT);
+    Chip_SCTPWM_SetRate(LPC_SCT, SoundFrequency(SOUND_A7));
+    Chip_SCTPWM_SetOutPin(LPC_SCT, BUZZER_PWM_CHANNEL, BUZZER_SCT_OUTPUT);
+    BuzzerTone(0);
+
+    // El temporizador cuenta milisegundos y se detiene al vencer, solo interrumpe en los cambios de nota
+    Chip_TIMER_Init(LPC_TIMER2);
+    Chip_TIMER_Disable(LPC_TIMER2);
+    Chip_TIMER_PrescaleSet(LPC_TIMER2, Chip_Clock_GetRate(CLK_MX_TIMER2) / 1000 - 1);
+    Chip_TIMER_StopOnMatchEnable(LPC_TIMER2, 0);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER2, 0);
+
+    NVIC_SetPriority(TIMER2_IRQn, (1 << __NVIC_PRIO_BITS) - 2);
+    NVIC_ClearPendingIRQ(TIMER2_IRQn);
+    NVIC_EnableIRQ(TIMER2_IRQn);
+}
+
+#if DISPLAY_SHIFT_DIGITS
+static void DisplayShiftInit(void) {
+    Chip_SCU_PinMuxSet(SPI_MOSI_PORT, SPI_MOSI_PIN, SCU_MODE_INACT | SPI_MOSI_FUNC);
+    Chip_SCU_PinMuxSet(SPI_SCK_PORT, SPI_SCK_PIN, SCU_MODE_INACT | SPI_SCK_FUNC);
+    Chip_SCU_PinMuxSet(GPIO_0_PORT, GPIO_0_PIN, SCU_MODE_INACT | GPIO_0_FUNC);
+    PinOutputInit(DISPLAY_LATCH);
+
+    Chip_SSP_Init(LPC_SSP1);
+    Chip_SSP_SetMaster(LPC_SSP1, true);
+    Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_MODE0);
+    Chip_SSP_SetBitRate(LPC_SSP1, DISPLAY_SHIFT_BITRATE);
+    Chip_SSP_Enable(LPC_SSP1);
+    Chip_SSP_DMA_Enable(LPC_SSP1);
+
+    displayTxChannel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_SSP1_Tx);
+}
+
+static void DisplayShiftSend(const uint8_t * data, uint8_t size) {
+    NVIC_DisableIRQ(DMA_IRQn);
+    // El buffer siguiente nunca es el que está leyendo el DMA, una trama encolada se reemplaza por la más nueva
+    memcpy(displayTx[displayTxNext], data, size);
+    if (displayTxBusy) {
+        displayTxQueued = true;
+    } else {
+        DisplayShiftStart();
+    }
+    NVIC_EnableIRQ(DMA_IRQn);
+}
+
+static void DisplayShiftStart(void) {
+    displayTxBusy = true;
+    displayTxQueued = false;
+    Chip_GPDMA_Transfer(LPC_GPDMA, displayTxChannel, (uint32_t)displayTx[displayTxNext], GPDMA_CONN_SSP1_Tx,
+                        GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, sizeof(displayTx[0]));
+    displayTxNext ^= 1;
+}
+#endif
+
+static bool DisplayCoreStart(uint16_t frameRate, uint16_t onTime) {
+    mailbox->frameRate = frameRate;
+    mailbox->onTime = onTime;
+    ScreenSetFrameRate(displayScreen, frameRate);
+    memset(&displayPublished, 0, sizeof(displayPublished));
+    CoprocPublish(mailbox, displayScreen, &displayPublished);
+
+    memset((void *)&displayStats, 0, sizeof(displayStats));
+    displayStats.frameRate = frameRate;
+    displayStats.onTime = onTime;
+
+    // El otro núcleo avisa con un evento cuando cambian las teclas, la interrupción solo despierta a este núcleo
+    NVIC_SetPriority(M0APP_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    NVIC_ClearPendingIRQ(M0APP_IRQn);
+    NVIC_EnableIRQ(M0APP_IRQn);
+
+    Chip_RGU_TriggerReset(RGU_M0APP_RST);
+    LPC_CREG->M0APPMEMMAP = COPROC_IMAGE_ADDRESS;
+    Chip_RGU_ClearReset(RGU_M0APP_RST);
+    return true;
 }
 
 /* === Public function implementation ============================================================================== */
 
 boardT BoardCreate(void) {
-    struct boardS * board = malloc(sizeof(struct boardS));
+    struct boardS * board;
+
+    // La pila se pinta antes que nada para que la medición incluya toda la inicialización
+    StackMonitorInit(&_vStackTop - STACK_SIZE / sizeof(uint32_t), &_vStackTop);
+
+    board = malloc(sizeof(struct boardS));
 
     if (board != NULL) {
+        // Inicialización de la EEPROM interna usada para guardar la configuración
+        Chip_EEPROM_Init(LPC_EEPROM);
+        Chip_EEPROM_SetAutoProg(LPC_EEPROM, EEPROM_AUTOPROG_OFF);
+        board->storage = StorageCreate(&storageDriver, STORAGE_HOLDOFF);
+        board->hibernate = &hibernateDriver;
+
+        // Inicialización del puerto serie de la consola, conectado al USB de depuración
+        SerialInit();
+        board->serial = &serialDriver;
+
+        // Los pines del display del poncho se inicializan siempre para que quede apagado si no se usa
         DigitsInit();
         SegmentsInit();
-        board->screen = ScreenCreate(4, &screenDriver);
+#if DISPLAY_SHIFT_DIGITS
+        // El display con registros usa el DMA, se configura después del puerto serie que inicializa el controlador
+        DisplayShiftInit();
+        board->screen = ScreenCreate(DISPLAY_DIGITS, ShiftScreenCreate(DISPLAY_DIGITS, DisplayShiftSend));
+#else
+        board->screen = ScreenCreate(DISPLAY_DIGITS, &screenDriver);
+#endif
+        displayScreen = board->screen;
+
+        // Inicialización del puerto RS-232 donde se conecta el receptor GPS usado como referencia de hora
+        Chip_SCU_PinMuxSet(UART_232_TX_PORT, UART_232_TX_PIN, SCU_MODE_PULLUP | UART_232_TX_FUNC);
+        Chip_SCU_PinMuxSet(UART_232_RX_PORT, UART_232_RX_PIN, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | UART_232_RX_FUNC);
+        Chip_UART_Init(LPC_USART3);
+        Chip_UART_SetBaud(LPC_USART3, REFERENCE_BAUDRATE);
+        Chip_UART_ConfigData(LPC_USART3, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+        Chip_UART_SetupFIFOS(LPC_USART3, UART_FCR_FIFO_EN);
+        board->reference = &referenceDriver;
+
+        // Inicialización del zumbador, las melodías se reproducen sin intervención del programa principal
+        BuzzerInit();
+        board->sound = SoundCreate(&buzzerDriver);
+        buzzerSound = board->sound;
 
         // Inicialización de las salidas del poncho
 
+#if !DISPLAY_SHIFT_DIGITS
+        // El LED rojo comparte el pin con la salida MOSI del conector SPI
         Chip_SCU_PinMuxSet(RGB_RED_PORT, RGB_RED_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_RED_FUNC);
+#endif
         board->ledRed = DigitalOutputCreate(RGB_RED_GPIO, RGB_RED_BIT, true);
 
         Chip_SCU_PinMuxSet(RGB_GREEN_PORT, RGB_GREEN_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_GREEN_FUNC);
@@ -158,25 +769,35 @@ boardT BoardCreate(void) {
 
         Chip_SCU_PinMuxSet(RGB_BLUE_PORT, RGB_BLUE_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_BLUE_FUNC);
         board->ledBlue = DigitalOutputCreate(RGB_BLUE_GPIO, RGB_BLUE_BIT, true);
+        LedPwmInit();
 
         // Inicialización de las entradas del poncho
         Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F1_FUNC);
-        board->setTime = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, true);
-
         Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F2_FUNC);
-        board->setAlarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, true);
-
         Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F3_FUNC);
-        board->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, true);
-
         Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F4_FUNC);
-        board->increment = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, true);
-
         Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_ACCEPT_FUNC);
-        board->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
-
         Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_CANCEL_FUNC);
-        board->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
+
+        // Sin un programa válido en el banco B de la flash el núcleo Cortex-M0 no se libera y se usa un solo núcleo
+        displayDualCore = DISPLAY_DUAL_CORE && CoprocImageValid((const uint32_t *)COPROC_IMAGE_ADDRESS);
+        if (displayDualCore) {
+            // Las teclas las filtra el núcleo Cortex-M0, que deja su estado en el buzón
+            MailboxInit(mailbox, 0, 0);
+            board->setTime = DigitalInputCreateWord(&mailbox->keys, KEY_F1_INDEX, false);
+            board->setAlarm = DigitalInputCreateWord(&mailbox->keys, KEY_F2_INDEX, false);
+            board->decrement = DigitalInputCreateWord(&mailbox->keys, KEY_F3_INDEX, false);
+            board->increment = DigitalInputCreateWord(&mailbox->keys, KEY_F4_INDEX, false);
+            board->accept = DigitalInputCreateWord(&mailbox->keys, KEY_ACCEPT_INDEX, false);
+            board->cancel = DigitalInputCreateWord(&mailbox->keys, KEY_CANCEL_INDEX, false);
+        } else {
+            board->setTime = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, true);
+            board->setAlarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, true);
+            board->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, true);
+            board->increment = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, true);
+            board->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
+            board->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
+        }
     }
 
     return board;
@@ -186,11 +807,195 @@ void SysTickInit(uint16_t ticks) {
     __asm volatile("cpsid i"); // Deshabilita las interrupciones
 
     SystemCoreClockUpdate(); // Actualiza la frecuencia del núcleo del sistema
-    SysTick_Config(SystemCoreClock / ticks); // Configura SysTick para interrupciones cada 1 ms
+    sysTickReload = SystemCoreClock / ticks;
+    sysTickRunning = 1;
+    sysTickLoaded = 1;
+    sysTickRequested = 1;
+    SysTick_Config(sysTickReload); // Configura SysTick para interrupciones cada 1 ms
 
     NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1); // Establece la prioridad más baja para SysTick
     
     __asm volatile("cpsie i"); // Habilita las interrupciones
 }
 
+bool SysTickSetPeriod(uint8_t ticks) {
+    if (ticks == 0 || sysTickReload * ticks - 1 > SysTick_LOAD_RELOAD_Msk) {
+        return false;
+    }
+    sysTickRequested = ticks;
+    return true;
+}
+
+HOT_PATH uint8_t SysTickElapsed(void) {
+    uint8_t elapsed = sysTickRunning;
+
+    // El contador acaba de recargarse, el nuevo período se carga ahora y se aplica en la próxima recarga sin perder
+    // la fracción en curso. Como solo se modifica desde la interrupción no hay carreras con el programa principal
+    sysTickRunning = sysTickLoaded;
+    if (sysTickRequested != sysTickLoaded) {
+        sysTickLoaded = sysTickRequested;
+        SysTick->LOAD = sysTickReload * sysTickLoaded - 1;
+    }
+    return elapsed;
+}
+
+bool DisplayScanInit(uint16_t frameRate, uint16_t onTime) {
+    if (!displayScreen || frameRate == 0) {
+        return false;
+    }
+    if (displayDualCore) {
+        // El barrido lo hace el núcleo Cortex-M0 con los mismos tiempos, este núcleo solo publica los cambios
+        return DisplayCoreStart(frameRate, onTime);
+    }
+    // El tiempo de encendido se reparte entre los intervalos de la modulación del brillo, el resto queda apagado
+    if (!CoprocScanTiming(&displayScan, frameRate, onTime, DISPLAY_DIGITS)) {
+        return false;
+    }
+
+    // El temporizador cuenta microsegundos y se reinicia al comenzar cada intervalo del barrido
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    Chip_TIMER_Init(LPC_TIMER1);
+    Chip_TIMER_Disable(LPC_TIMER1);
+    Chip_TIMER_Reset(LPC_TIMER1);
+    Chip_TIMER_PrescaleSet(LPC_TIMER1, Chip_Clock_GetRate(CLK_MX_TIMER1) / 1000000 - 1);
+
+    Chip_TIMER_SetMatch(LPC_TIMER1, 0, 0); // El primer intervalo comienza en el próximo tick
+    Chip_TIMER_ResetOnMatchEnable(LPC_TIMER1, 0);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER1, 0);
+
+    // Un segundo comparador apaga el dígito al comenzar el intervalo apagado
+    Chip_TIMER_SetMatch(LPC_TIMER1, 1, UINT32_MAX);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER1, 1);
+
+    ScreenSetFrameRate(displayScreen, frameRate);
+    memset((void *)&displayStats, 0, sizeof(displayStats));
+    displayStats.frameRate = frameRate;
+    displayStats.onTime = displayScan.unit * SCREEN_BRIGHTNESS_MAX;
+
+    NVIC_SetPriority(TIMER1_IRQn, (1 << __NVIC_PRIO_BITS) - 3);
+    NVIC_ClearPendingIRQ(TIMER1_IRQn);
+    NVIC_EnableIRQ(TIMER1_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER1);
+    return true;
+}
+
+void DisplayScanGetStats(displayScanStatsT * stats) {
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    memcpy(stats, (const void *)&displayStats, sizeof(displayScanStatsT));
+    NVIC_EnableIRQ(TIMER1_IRQn);
+}
+
+void DisplayScanEnable(bool enabled) {
+    if (displayDualCore || !displayScreen || displayScan.unit == 0) {
+        return; // El otro núcleo sigue barriendo con el brillo publicado, o el barrido no se inició
+    }
+    if (enabled) {
+        Chip_TIMER_Enable(LPC_TIMER1);
+    } else {
+        // Con el temporizador detenido no hay más interrupciones del barrido, el display queda apagado
+        Chip_TIMER_Disable(LPC_TIMER1);
+        ScreenBlank(displayScreen);
+    }
+}
+
+void DisplayScanPublish(void) {
+    if (displayDualCore) {
+        CoprocPublish(mailbox, displayScreen, &displayPublished);
+    }
+}
+
+void BoardIdle(void) {
+    if (displayDualCore) {
+        __WFI(); // Las teclas llegan filtradas, se duerme hasta la próxima interrupción o evento del otro núcleo
+        return;
+    }
+    // La demora entre lecturas filtra los rebotes de las teclas
+    for (int delay = 0; delay < 25000; delay++) {
+        __asm("NOP");
+    }
+}
+
+void BoardSleep(void) {
+    __WFI();
+}
+
+HOT_PATH void TIMER1_IRQHandler(void) {
+    uint32_t start = CYCLES_NOW();
+    uint32_t blank;
+    uint8_t weight;
+
+    STACK_ISR_ENTER();
+    if (Chip_TIMER_MatchPending(LPC_TIMER1, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+        weight = ScreenRefresh(displayScreen);
+        displayStats.refreshes++;
+
+        Chip_TIMER_SetMatch(LPC_TIMER1, 0, CoprocScanSchedule(&displayScan, weight, &blank));
+        Chip_TIMER_SetMatch(LPC_TIMER1, 1, blank);
+    }
+    if (Chip_TIMER_MatchPending(LPC_TIMER1, 1)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER1, 1);
+        ScreenBlank(displayScreen);
+    }
+
+    start = CYCLES_NOW() - start;
+    displayStats.cycles += start;
+    if (start > displayStats.maxCycles) {
+        displayStats.maxCycles = start;
+    }
+    STACK_ISR_EXIT();
+}
+
+void TIMER2_IRQHandler(void) {
+    STACK_ISR_ENTER();
+    if (Chip_TIMER_MatchPending(LPC_TIMER2, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER2, 0);
+        SoundNext(buzzerSound);
+    }
+    STACK_ISR_EXIT();
+}
+
+void TIMER3_IRQHandler(void) {
+    STACK_ISR_ENTER();
+    if (Chip_TIMER_MatchPending(LPC_TIMER3, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER3, 0);
+        // Con la prioridad más baja la interrupción se puede atrasar más que el intervalo al próximo flanco. Si el
+        // contador ya pasó la comparación se aplica el flanco en el momento, en lugar de esperar que dé la vuelta
+        do {
+            ledPwmMatch += DigitalPwmUpdate();
+            Chip_TIMER_SetMatch(LPC_TIMER3, 0, ledPwmMatch);
+        } while ((int32_t)(Chip_TIMER_ReadCount(LPC_TIMER3) - ledPwmMatch) >= 0);
+    }
+    STACK_ISR_EXIT();
+}
+
+void DMA_IRQHandler(void) {
+    STACK_ISR_ENTER();
+    if (Chip_GPDMA_Interrupt(LPC_GPDMA, serialTxChannel) == SUCCESS) {
+        serialTxTail = (serialTxTail + serialTxPending) & (SERIAL_TX_SIZE - 1);
+        SerialTransmit();
+    }
+    Chip_GPDMA_Interrupt(LPC_GPDMA, serialRxChannel);
+#if DISPLAY_SHIFT_DIGITS
+    if (Chip_GPDMA_Interrupt(LPC_GPDMA, displayTxChannel) == SUCCESS) {
+        // El DMA termina al cargar el FIFO, el latch espera a que el SSP desplace el último bit
+        while (Chip_SSP_GetStatus(LPC_SSP1, SSP_STAT_BSY) == SET) {
+        }
+        PinActivate(DISPLAY_LATCH);
+        PinDesactivate(DISPLAY_LATCH);
+        displayTxBusy = false;
+        if (displayTxQueued) {
+            DisplayShiftStart();
+        }
+    }
+#endif
+    STACK_ISR_EXIT();
+}
+
+#if DISPLAY_DUAL_CORE
+void M0APP_IRQHandler(void) {
+    LPC_CREG->M0APPTXEVENT = 0; // El evento solo despierta al núcleo, las teclas se leen del buzón en el lazo
+}
+#endif
+
 /* === End of documentation ======================================================================================== */
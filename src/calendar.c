@@ -0,0 +1,105 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file calendar.c
+ ** @brief Implementación de la conversión entre fechas civiles y días desde la época
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calendar.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define DAYS_PER_ERA        146097UL //!< Días en un ciclo gregoriano de 400 años
+#define DAYS_FROM_ERA_START 719468UL //!< Días entre el 1 de marzo del año 0 y la época
+#define EPOCH_WEEKDAY       CALENDAR_THURSDAY
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief  Obtiene la cantidad de días de un mes.
+ *
+ * @param year  Año al que pertenece el mes.
+ * @param month  Mes, de 1 a 12.
+ * @return uint8_t Cantidad de días del mes.
+ */
+static uint8_t DaysInMonth(uint16_t year, uint8_t month);
+
+/* === Private variable definitions ================================================================================ */
+
+static const uint8_t DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t DaysInMonth(uint16_t year, uint8_t month) {
+    bool leap = (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+    return DAYS_IN_MONTH[month - 1] + ((month == 2) && leap);
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool CalendarIsValid(const calendarDateT * date) {
+    if (!date) {
+        return false; // Protección ante NULL
+    }
+    if (date->year < CALENDAR_EPOCH_YEAR || date->month < 1 || date->month > 12 || date->day < 1) {
+        return false;
+    }
+    return date->day <= DaysInMonth(date->year, date->month);
+}
+
+// Los años se cuentan desde el 1 de marzo, así el día bisiesto queda al final y no hace falta tratarlo aparte
+uint32_t CalendarToDays(const calendarDateT * date) {
+    uint32_t year = date->year - (date->month <= 2);
+    uint32_t era = year / 400;
+    uint32_t yearOfEra = year - era * 400;
+    uint32_t month = date->month > 2 ? date->month - 3 : date->month + 9;
+    uint32_t dayOfYear = (153 * month + 2) / 5 + date->day - 1;
+    uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * DAYS_PER_ERA + dayOfEra - DAYS_FROM_ERA_START;
+}
+
+void CalendarFromDays(uint32_t days, calendarDateT * date) {
+    uint32_t shifted = days + DAYS_FROM_ERA_START;
+    uint32_t era = shifted / DAYS_PER_ERA;
+    uint32_t dayOfEra = shifted - era * DAYS_PER_ERA;
+    uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    uint32_t month = (5 * dayOfYear + 2) / 153;
+
+    date->day = dayOfYear - (153 * month + 2) / 5 + 1;
+    date->month = month < 10 ? month + 3 : month - 9;
+    date->year = yearOfEra + era * 400 + (date->month <= 2);
+    date->weekday = CalendarWeekday(days);
+}
+
+uint8_t CalendarWeekday(uint32_t days) {
+    return (days + EPOCH_WEEKDAY) % 7;
+}
+
+/* === End of documentation ======================================================================================== */
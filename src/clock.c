@@ -25,19 +25,47 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock.h"
+#include "hotpath.h"
+#include <stddef.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#ifndef CLOCK_SNOOZE_LIMIT
+#define CLOCK_SNOOZE_LIMIT 3 //!< Cantidad máxima de posposiciones por defecto
+#endif
+
+#define SECONDS_PER_DAY 86400UL //!< Cantidad de segundos en un día
+
+#define PHASE_ONE_SECOND (1ULL << 63) //!< Valor del acumulador de fase que corresponde a un segundo
+#define PPB              1000000000UL //!< Partes por billón en la unidad
+
 /* === Private data type declarations ============================================================================== */
 
 struct clockS {
-    uint16_t ticks;                  //!< Contador de ticks del reloj
-    uint16_t ticksPerSecond;         //!< Cantidad de ticks por segundo
+    uint64_t phase;                  //!< Fracción del segundo acumulada, PHASE_ONE_SECOND equivale a un segundo
+    uint64_t phaseIncrement;         //!< Fracción de segundo que se suma al acumulador en cada tick
+    uint32_t rateNumerator;          //!< Numerador de la frecuencia de ticks en Hz
+    uint16_t rateDenominator;        //!< Denominador de la frecuencia de ticks en Hz
+    int32_t trim;                    //!< Corrección de la frecuencia en partes por billón
     clockTimeT currentTime;          //!< Hora actual del reloj
     clockTimeT alarm;                //!< Hora de la alarma
+    uint32_t seconds;                //!< Segundos transcurridos desde las 00:00:00
+    uint32_t days;                   //!< Días transcurridos desde la época
+    uint32_t utc;                    //!< Hora base en segundos UTC desde la época
+    int32_t utcOffset;               //!< Desplazamiento de la hora local respecto de UTC, en segundos
+    uint32_t nextTransition;         //!< Instante UTC del próximo cambio de desplazamiento
+    timezoneT timezone;              //!< Zona horaria usada para obtener la hora local
+    uint32_t cachedDays;             //!< Día al que corresponde la fecha calculada en cachedDate
+    calendarDateT cachedDate;        //!< Fecha civil calculada la última vez que se consultó
+    uint32_t alarmSeconds;           //!< Hora de la alarma en segundos desde las 00:00:00
+    uint32_t snoozeDeadline;         //!< Segundo del día en que vence la posposición
+    uint8_t snoozeCount;             //!< Cantidad de posposiciones desde que sonó la alarma
+    uint8_t snoozeLimit;             //!< Cantidad máxima de posposiciones permitidas
+    bool snoozePending;              //!< Indica si hay una posposición pendiente
     bool validTime;                  //!< Indica si la hora actual es válida
     bool validAlarm;                 //!< Indica si la hora de la alarma es válida
+    bool validDate;                  //!< Indica si la fecha actual es válida
     bool alarmActive;                //!< Indica si la alarma está activa
     bool alarmEnabled;               //!< Indica si la alarma está habilitada
     bool alarmRingingNow;            //!< Indica si la alarma está sonando en este momento
@@ -63,12 +91,23 @@ static void AdvanceTime(clockT self);
 static bool IsValidTime(const clockTimeT * time);
 
 /**
- * @brief  Pospone la alarma por una cantidad de minutos especificada.
+ * @brief  Aplica un estado obtenido con ClockGetState, con las marcas de validez que contiene.
  *
  * @param self  Referencia al objeto reloj.
- * @param minutes  Cantidad de minutos para posponer la alarma.
+ * @param state  Puntero al estado a aplicar.
+ * @param flags  Marcas de validez que se aplican, las que no están en el estado se ignoran.
+ * @return true Si el estado es coherente y se aplicó.
+ * @return false Si el puntero es NULL o el estado está corrupto o es de otra versión.
+ */
+static bool ApplyState(clockT self, const clockStateT * state, uint8_t flags);
+
+/**
+ * @brief  Convierte una hora en formato BCD a segundos transcurridos desde las 00:00:00.
+ *
+ * @param time  Puntero a la estructura de hora a convertir.
+ * @return uint32_t Cantidad de segundos desde el inicio del día.
  */
-static void AlarmPospone(clockT self, uint8_t minutes);
+static uint32_t BcdToSeconds(const clockTimeT * time);
 
 /**
  * @brief  Incrementa un valor en formato BCD (Binary-Coded Decimal).
@@ -83,13 +122,45 @@ static void AlarmPospone(clockT self, uint8_t minutes);
 static bool BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens);
 
 /**
- * @brief  Verifica si ha pasado un nuevo día comparando la hora previa con la actual.
+ * @brief  Convierte una cantidad de segundos desde las 00:00:00 a una hora en formato BCD.
+ *
+ * @param seconds  Cantidad de segundos desde el inicio del día.
+ * @param time  Puntero a la estructura donde se almacenará la hora.
+ */
+static void SecondsToBcd(uint32_t seconds, clockTimeT * time);
+
+/**
+ * @brief  Recalcula la hora base UTC a partir de la hora y fecha locales y el próximo cambio de horario.
  *
- * @param prev  Hora previa del reloj.
- * @return true Si ha pasado un nuevo día.
- * @return false Si no ha pasado un nuevo día.
+ * @param self  Referencia al objeto reloj.
  */
-static bool IsNewDay(clockTimeT prev);
+static void UpdateUtc(clockT self);
+
+/**
+ * @brief  Aplica el cambio de desplazamiento de la zona horaria al alcanzar el instante de transición.
+ *
+ * @param self  Referencia al objeto reloj.
+ */
+static void ApplyTransition(clockT self);
+
+/**
+ * @brief  Calcula el incremento del acumulador de fase para una frecuencia y una corrección dadas.
+ *
+ * @param numerator  Numerador de la frecuencia de ticks en Hz.
+ * @param denominator  Denominador de la frecuencia de ticks en Hz.
+ * @param trim  Corrección de la frecuencia en partes por billón.
+ * @param increment  Puntero donde se almacena el incremento, redondeado hacia arriba.
+ * @return true Si la frecuencia corregida es de al menos un tick por segundo.
+ * @return false Si la frecuencia no es válida.
+ */
+static bool PhaseIncrement(uint32_t numerator, uint16_t denominator, int32_t trim, uint64_t * increment);
+
+/**
+ * @brief  Descarta la posposición pendiente y reinicia el contador de posposiciones.
+ *
+ * @param self  Referencia al objeto reloj.
+ */
+static void SnoozeReset(clockT self);
 
 /* === Private variable definitions ================================================================================ */
 
@@ -98,20 +169,28 @@ static bool IsNewDay(clockTimeT prev);
 /* === Private function definitions ================================================================================ */
 
 static void AdvanceTime(clockT self) {
-    // Guardar hora previa para detectar el paso de un día
-    clockTimeT previousTime = self->currentTime;
-
     if (BcdIncrement(&self->currentTime.time.seconds[0], &self->currentTime.time.seconds[1], 9, 5)) {
         if (BcdIncrement(&self->currentTime.time.minutes[0], &self->currentTime.time.minutes[1], 9, 5)) {
-            BcdIncrement(&self->currentTime.time.hours[0], &self->currentTime.time.hours[1], 3, 2);
+            BcdIncrement(&self->currentTime.time.hours[0], &self->currentTime.time.hours[1], 9, 2);
         }
     }
 
-    // Detectar paso de 23:59:59 a 00:00:00
-    if (IsNewDay(previousTime)) {
+    // Detectar paso de 23:59:59 a 00:00:00, la fecha solo se actualiza una vez por día
+    self->seconds++;
+    if (self->seconds >= SECONDS_PER_DAY) {
+        self->seconds = 0;
+        self->currentTime.time.hours[0] = 0;
+        self->currentTime.time.hours[1] = 0;
+        self->days++;
         self->alarmActive = true; // Si es un nuevo día, activar la alarma
     }
 
+    // Las reglas de la zona horaria solo se evalúan al llegar a la transición precalculada
+    self->utc++;
+    if (self->utc >= self->nextTransition) {
+        ApplyTransition(self);
+    }
+
     // Verificar si alarma debe sonar y disparar callback
     ClockAlarmRinging(self);
 }
@@ -125,29 +204,112 @@ static bool IsValidTime(const clockTimeT * time) {
     return isValid;
 }
 
-static void AlarmPospone(clockT self, uint8_t minutes) {
-    // Convertir minutos actuales a decimal
-    uint8_t dec_minutes = self->alarm.time.minutes[1] * 10 + self->alarm.time.minutes[0];
-    uint8_t dec_hours = self->alarm.time.hours[1] * 10 + self->alarm.time.hours[0];
+static bool ApplyState(clockT self, const clockStateT * state, uint8_t flags) {
+    if (!self || !state) {
+        return false; // Protección ante NULL
+    }
+    if (state->seconds >= SECONDS_PER_DAY || state->alarmSeconds >= SECONDS_PER_DAY) {
+        return false; // Estado corrupto o de otra versión
+    }
+    flags &= state->flags;
+
+    self->days = state->days;
+    self->seconds = state->seconds;
+    SecondsToBcd(self->seconds, &self->currentTime);
+    self->validTime = flags & CLOCK_STATE_VALID_TIME;
+    self->validDate = flags & CLOCK_STATE_VALID_DATE;
+
+    self->alarmSeconds = state->alarmSeconds;
+    SecondsToBcd(self->alarmSeconds, &self->alarm);
+    self->validAlarm = flags & CLOCK_STATE_VALID_ALARM;
+    self->alarmEnabled = self->validAlarm && (flags & CLOCK_STATE_ALARM_ENABLED);
+    self->alarmActive = self->validAlarm;
+    self->alarmRingingNow = false;
+    SnoozeReset(self);
+    self->snoozeLimit = state->snoozeLimit;
+
+    ClockSetTrim(self, state->trim);
+    UpdateUtc(self);
+    return true;
+}
+
+static uint32_t BcdToSeconds(const clockTimeT * time) {
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10 + time->time.seconds[0];
+
+    return hours * 3600 + minutes * 60 + seconds;
+}
+
+static void SecondsToBcd(uint32_t seconds, clockTimeT * time) {
+    uint8_t hours = seconds / 3600;
+    uint8_t minutes = (seconds / 60) % 60;
+
+    seconds = seconds % 60;
+    time->time.hours[1] = hours / 10;
+    time->time.hours[0] = hours % 10;
+    time->time.minutes[1] = minutes / 10;
+    time->time.minutes[0] = minutes % 10;
+    time->time.seconds[1] = seconds / 10;
+    time->time.seconds[0] = seconds % 10;
+}
+
+static void UpdateUtc(clockT self) {
+    uint32_t local = self->days * SECONDS_PER_DAY + self->seconds;
+    int32_t offset = TimezoneOffset(self->timezone, local - self->utcOffset, &self->nextTransition);
+
+    if (offset != self->utcOffset) {
+        // La hora local se interpreta con el desplazamiento vigente en ese instante
+        offset = TimezoneOffset(self->timezone, local - offset, &self->nextTransition);
+    }
+    self->utcOffset = offset;
+    self->utc = local - offset;
+}
+
+static void ApplyTransition(clockT self) {
+    int32_t offset = TimezoneOffset(self->timezone, self->utc, &self->nextTransition);
 
-    // Sumar los minutos
-    dec_minutes += minutes;
+    if (offset != self->utcOffset) {
+        uint32_t local = self->utc + offset;
 
-    // Ajustar horas si hay overflow de minutos
-    dec_hours += dec_minutes / 60;
-    dec_minutes = dec_minutes % 60;
+        self->utcOffset = offset;
+        self->days = local / SECONDS_PER_DAY;
+        self->seconds = local % SECONDS_PER_DAY;
+        SecondsToBcd(self->seconds, &self->currentTime);
+    }
+}
 
-    // Ajustar si pasa de 23:59
-    if (dec_hours >= 24) {
-        dec_hours = dec_hours % 24;
+// La división larga se hace una sola vez al configurar la frecuencia, nunca en cada tick
+static bool PhaseIncrement(uint32_t numerator, uint16_t denominator, int32_t trim, uint64_t * increment) {
+    uint64_t dividend, divisor, quotient, remainder;
+
+    if (denominator == 0 || trim <= -(int32_t)PPB) {
+        return false;
+    }
+    dividend = (uint64_t)denominator * (uint64_t)(PPB + trim);
+    divisor = (uint64_t)numerator * PPB;
+    if (divisor == 0 || dividend > divisor) {
+        return false; // Un tick debe durar como máximo un segundo
     }
 
-    // Convertir de vuelta a BCD
-    self->alarm.time.minutes[1] = dec_minutes / 10;
-    self->alarm.time.minutes[0] = dec_minutes % 10;
+    quotient = dividend / divisor;
+    remainder = dividend % divisor;
+    for (int bit = 0; bit < 63; bit++) {
+        quotient <<= 1;
+        remainder <<= 1;
+        if (remainder >= divisor) {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+    }
+    // Redondear hacia arriba evita que el segundo llegue un tick tarde cuando la división es inexacta
+    *increment = quotient + (remainder != 0);
+    return true;
+}
 
-    self->alarm.time.hours[1] = dec_hours / 10;
-    self->alarm.time.hours[0] = dec_hours % 10;
+static void SnoozeReset(clockT self) {
+    self->snoozePending = false;
+    self->snoozeCount = 0;
 }
 
 static bool BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens) {
@@ -163,14 +325,6 @@ static bool BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uin
     return false;
 }
 
-static bool IsNewDay(clockTimeT prev) {
-    if (prev.time.hours[1] == 2 && prev.time.hours[0] == 3 && prev.time.minutes[1] == 5 && prev.time.minutes[0] == 9 &&
-        prev.time.seconds[1] == 5 && prev.time.seconds[0] == 9) {
-        return true; // Se ha detectado un nuevo día
-    }
-    return false; // No se ha detectado un nuevo día
-}
-
 /* === Public function implementation ============================================================================== */
 
 clockT ClockCreate(uint16_t ticksPerSecond, clockAlarmRingingT function) {
@@ -181,7 +335,11 @@ clockT ClockCreate(uint16_t ticksPerSecond, clockAlarmRingingT function) {
     self->alarmActive = false;
     self->alarmEnabled = false;
     self->alarmRingingNow = false;
-    self->ticksPerSecond = ticksPerSecond;
+    self->validDate = false;
+    self->cachedDays = UINT32_MAX; // Fuerza el cálculo de la fecha en la primera consulta
+    self->nextTransition = TIMEZONE_NO_TRANSITION;
+    self->snoozeLimit = CLOCK_SNOOZE_LIMIT;
+    ClockSetTickRate(self, ticksPerSecond, 1);
     self->alarmRinging = function;
     return self;
 }
@@ -201,6 +359,8 @@ bool ClockSetTime(clockT self, const clockTimeT * newTime) {
 
     if (IsValidTime(newTime)) {
         memcpy(&self->currentTime, newTime, sizeof(clockTimeT));
+        self->seconds = BcdToSeconds(newTime);
+        UpdateUtc(self);
         self->validTime = true; // Hora válida
     } else {
         self->validTime = false; // Hora no válida
@@ -208,12 +368,108 @@ bool ClockSetTime(clockT self, const clockTimeT * newTime) {
     return self->validTime;
 }
 
-bool ClockNewTick(clockT self) {
+bool ClockSetDate(clockT self, const calendarDateT * date) {
+    if (!self || !date) {
+        return false; // Protección ante NULL
+    }
+
+    if (CalendarIsValid(date)) {
+        self->days = CalendarToDays(date);
+        UpdateUtc(self);
+        self->validDate = true;
+    } else {
+        self->validDate = false;
+    }
+    return self->validDate;
+}
+
+bool ClockGetDate(clockT self, calendarDateT * date) {
+    if (!self || !date) {
+        return false; // Protección ante NULL
+    }
+
+    // La conversión a fecha civil se hace a lo sumo una vez por día
+    if (self->cachedDays != self->days) {
+        CalendarFromDays(self->days, &self->cachedDate);
+        self->cachedDays = self->days;
+    }
+    memcpy(date, &self->cachedDate, sizeof(calendarDateT));
+    return self->validDate;
+}
+
+uint32_t ClockGetDays(clockT self) {
+    return self ? self->days : 0;
+}
+
+void ClockSetTimezone(clockT self, timezoneT zone) {
     if (self) {
-        self->ticks++;
+        self->timezone = zone;
+        UpdateUtc(self); // Se conserva la hora local y se recalcula la hora base
+    }
+}
+
+timezoneT ClockGetTimezone(clockT self) {
+    return self ? self->timezone : NULL;
+}
 
-        if (self->ticks >= self->ticksPerSecond) {
-            self->ticks = 0;
+uint32_t ClockGetUtc(clockT self) {
+    return self ? self->utc : 0;
+}
+
+bool ClockSetUtc(clockT self, uint32_t utc) {
+    if (!self) {
+        return false; // Protección ante NULL
+    }
+
+    self->utc = utc;
+    self->utcOffset = TimezoneOffset(self->timezone, utc, &self->nextTransition);
+    utc += self->utcOffset;
+    self->days = utc / SECONDS_PER_DAY;
+    self->seconds = utc % SECONDS_PER_DAY;
+    SecondsToBcd(self->seconds, &self->currentTime);
+    self->phase = 0;
+    self->validTime = true;
+    self->validDate = true;
+    return true;
+}
+
+uint32_t ClockGetFraction(clockT self) {
+    return self ? (uint32_t)(self->phase >> 31) : 0;
+}
+
+int32_t ClockGetUtcOffset(clockT self) {
+    return self ? self->utcOffset : 0;
+}
+
+bool ClockSetTickRate(clockT self, uint32_t numerator, uint16_t denominator) {
+    uint64_t increment;
+
+    if (!self || !PhaseIncrement(numerator, denominator, self->trim, &increment)) {
+        return false;
+    }
+    self->rateNumerator = numerator;
+    self->rateDenominator = denominator;
+    self->phaseIncrement = increment;
+    return true;
+}
+
+bool ClockSetTrim(clockT self, int32_t trim) {
+    uint64_t increment;
+
+    if (!self || !PhaseIncrement(self->rateNumerator, self->rateDenominator, trim, &increment)) {
+        return false;
+    }
+    self->trim = trim;
+    self->phaseIncrement = increment;
+    return true;
+}
+
+HOT_PATH bool ClockNewTick(clockT self) {
+    if (self) {
+        self->phase += self->phaseIncrement;
+
+        if (self->phase & PHASE_ONE_SECOND) {
+            self->phase &= ~PHASE_ONE_SECOND;
             AdvanceTime(self);
             return true;
         }
@@ -236,6 +492,8 @@ bool ClockSetAlarm(clockT self, const clockTimeT * alarm) {
     }
 
     memcpy(&self->alarm, alarm, sizeof(clockTimeT));
+    self->alarmSeconds = BcdToSeconds(alarm);
+    SnoozeReset(self);
     self->validAlarm = true;
     self->alarmEnabled = true;
     self->alarmActive = true;
@@ -250,6 +508,33 @@ bool ClockGetAlarm(clockT self, clockTimeT * alarm) {
     return false; // Si el reloj o el puntero de alarma son NULL, retorna false
 }
 
+bool ClockGetState(clockT self, clockStateT * state) {
+    if (!self || !state) {
+        return false; // Protección ante NULL
+    }
+
+    memset(state, 0, sizeof(clockStateT));
+    state->days = self->days;
+    state->seconds = self->seconds;
+    state->alarmSeconds = self->alarmSeconds;
+    state->trim = self->trim;
+    state->snoozeLimit = self->snoozeLimit;
+    state->flags = (self->validTime ? CLOCK_STATE_VALID_TIME : 0) | (self->validDate ? CLOCK_STATE_VALID_DATE : 0) |
+                   (self->validAlarm ? CLOCK_STATE_VALID_ALARM : 0) |
+                   (self->alarmEnabled ? CLOCK_STATE_ALARM_ENABLED : 0) |
+                   (self->snoozePending ? CLOCK_STATE_SNOOZED : 0);
+    return true;
+}
+
+bool ClockSetState(clockT self, const clockStateT * state) {
+    return ApplyState(self, state, UINT8_MAX) && self->validTime;
+}
+
+bool ClockRestoreSettings(clockT self, const clockStateT * state) {
+    // La hora guardada quedó atrasada por el tiempo sin alimentación, se muestra pero hay que confirmarla
+    return ApplyState(self, state, (uint8_t)~CLOCK_STATE_VALID_TIME);
+}
+
 bool ClockIsAlarmActive(clockT self) {
     return self ? self->alarmActive : false; // Retorna si la alarma está activa
 }
@@ -264,10 +549,12 @@ void ClockAlarmAction(clockT self, AlarmActions action) {
         case ALARM_CANCEL:
             self->alarmActive = false;     // Cancela la alarma
             self->alarmRingingNow = false; // Apaga sonido actual
+            SnoozeReset(self);
             break;
         case ALARM_DISABLE:
             self->alarmEnabled = false;    // Desactiva la alarma
             self->alarmRingingNow = false; // Apaga sonido actual si estaba
+            SnoozeReset(self);
             break;
         case ALARM_ENABLE:
             self->alarmEnabled = true; // Habilita la alarma
@@ -276,17 +563,45 @@ void ClockAlarmAction(clockT self, AlarmActions action) {
     }
 }
 
-void ClockSnoozeAlarm(clockT self, uint8_t minutes) {
-    if (self && self->alarmActive && self->alarmEnabled) {
-        self->alarmRingingNow = false; // Evita que suene inmediatamente otra vez
-        AlarmPospone(self, minutes);   // Pospone la alarma
+bool ClockSnoozeAlarm(clockT self, uint8_t minutes) {
+    if (!self || !self->alarmActive || !self->alarmEnabled) {
+        return false;
+    }
+    if (self->snoozeCount >= self->snoozeLimit) {
+        return false; // Se alcanzó el límite de posposiciones, la alarma sigue sonando
+    }
+
+    // La posposición se guarda aparte para no modificar la hora configurada de la alarma
+    self->snoozeDeadline = self->seconds + (uint32_t)minutes * 60;
+    if (self->snoozeDeadline >= SECONDS_PER_DAY) {
+        self->snoozeDeadline -= SECONDS_PER_DAY;
     }
+    self->snoozePending = true;
+    self->snoozeCount++;
+    self->alarmRingingNow = false; // Evita que suene inmediatamente otra vez
+    return true;
+}
+
+void ClockSetSnoozeLimit(clockT self, uint8_t limit) {
+    if (self) {
+        self->snoozeLimit = limit;
+    }
+}
+
+uint8_t ClockGetSnoozeCount(clockT self) {
+    return self ? self->snoozeCount : 0;
 }
 
 void ClockAlarmRinging(clockT self) {
-    if (self && self->alarmEnabled && self->alarmActive) {
-        if (!self->alarmRingingNow && !memcmp(&self->currentTime, &self->alarm, sizeof(clockTimeT))) {
+    if (self && self->alarmEnabled && self->alarmActive && !self->alarmRingingNow) {
+        if (self->seconds == self->alarmSeconds) {
+            SnoozeReset(self); // La alarma configurada inicia un nuevo ciclo de posposiciones
+            self->alarmRingingNow = true;
+        } else if (self->snoozePending && self->seconds == self->snoozeDeadline) {
+            self->snoozePending = false;
             self->alarmRingingNow = true;
+        }
+        if (self->alarmRingingNow && self->alarmRinging) {
             self->alarmRinging(self);
         }
     }
@@ -0,0 +1,677 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file console.c
+ ** @brief Implementación de la consola de comandos y telemetría por puerto serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "console.h"
+#include "calendar.h"
+#include "stack.h"
+#include "trace.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef CONSOLE_LINE_SIZE
+#define CONSOLE_LINE_SIZE 40 //!< Longitud máxima de una línea de comando, admite `zone` con la descripción más larga
+#endif
+
+#define CONSOLE_READ_SIZE   16 //!< Cantidad de bytes que se leen del driver en cada paso
+#define CONSOLE_OUTPUT_SIZE 48 //!< Longitud máxima de una línea de respuesta
+#define CONSOLE_TRACE_SIZE  24 //!< Longitud de una línea del volcado del registro de eventos
+#define CONSOLE_KEYS_SIZE   46 //!< Longitud de una línea del volcado del registro de teclas
+#define CONSOLE_KEYS_LINE   8  //!< Entradas del registro de teclas en cada línea del volcado
+
+/* === Private data type declarations ============================================================================== */
+
+struct consoleS {
+    consoleDriverT driver;          //!< Driver del puerto serie
+    clockT clock;                   //!< Reloj que se consulta y configura
+    consoleChangedT changed;        //!< Función que se llama al modificar el reloj
+    char line[CONSOLE_LINE_SIZE];   //!< Línea de comando en recepción
+    uint8_t length;                 //!< Cantidad de caracteres recibidos en la línea
+    bool overflow;                  //!< Indica si la línea recibida superó la longitud máxima
+    bool watch;                     //!< Indica si se transmiten los cambios de estado
+    uint32_t commands;              //!< Cantidad de comandos ejecutados
+    uint32_t dropped;               //!< Cantidad de bytes de salida descartados por falta de espacio
+    bool tracing;                   //!< Indica si hay un volcado del registro de eventos en curso
+    uint32_t traceCursor;           //!< Próximo registro de eventos a transmitir
+    powerT power;                   //!< Política de consumo que se informa con `stats`, puede ser NULL
+    syncT sync;                     //!< Sincronización con la referencia que se informa con `stats`, puede ser NULL
+    keylogT keylog;                 //!< Registro de teclas que se vuelca con `keys`, puede ser NULL
+    bool dumpingKeys;               //!< Indica si hay un volcado del registro de teclas en curso
+    uint16_t keysCursor;            //!< Próxima entrada del registro de teclas a transmitir
+};
+
+//! Respuesta en construcción
+typedef struct consoleOutputS {
+    char text[CONSOLE_OUTPUT_SIZE]; //!< Texto de la respuesta
+    uint8_t length;                 //!< Cantidad de caracteres de la respuesta
+} consoleOutputT;
+
+typedef bool (*consoleCommandT)(consoleT self, const char * argument);
+
+//! Entrada de la tabla de comandos
+typedef struct consoleEntryS {
+    const char * name;       //!< Nombre del comando
+    consoleCommandT Execute; //!< Función que ejecuta el comando
+} consoleEntryT;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega un carácter recibido a la línea en curso y ejecuta el comando al completarse la línea.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param data  Carácter recibido.
+ */
+static void ProcessChar(consoleT self, char data);
+
+/**
+ * @brief Busca el comando de la línea recibida en la tabla y lo ejecuta.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ */
+static void ExecuteLine(consoleT self);
+
+/**
+ * @brief Agrega un texto a la respuesta en construcción.
+ *
+ * @param output  Puntero a la respuesta.
+ * @param text  Texto a agregar.
+ */
+static void Append(consoleOutputT * output, const char * text);
+
+/**
+ * @brief Agrega un número decimal a la respuesta en construcción.
+ *
+ * @param output  Puntero a la respuesta.
+ * @param value  Valor a agregar.
+ * @param width  Cantidad mínima de dígitos, se completa con ceros a la izquierda.
+ */
+static void AppendNumber(consoleOutputT * output, int32_t value, uint8_t width);
+
+/**
+ * @brief Agrega un número hexadecimal de cantidad de dígitos fija a la respuesta en construcción.
+ *
+ * @param output  Puntero a la respuesta.
+ * @param value  Valor a agregar.
+ * @param digits  Cantidad de dígitos.
+ */
+static void AppendHex(consoleOutputT * output, uint32_t value, uint8_t digits);
+
+/**
+ * @brief Transmite los registros de eventos pendientes del volcado mientras haya espacio para líneas completas.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ */
+static void TransmitTrace(consoleT self);
+
+/**
+ * @brief Transmite las entradas pendientes del volcado del registro de teclas mientras haya espacio para líneas
+ *        completas.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ */
+static void TransmitKeys(consoleT self);
+
+/**
+ * @brief Agrega una hora en formato HH:MM:SS a la respuesta en construcción.
+ *
+ * @param output  Puntero a la respuesta.
+ * @param time  Hora en formato BCD.
+ */
+static void AppendTime(consoleOutputT * output, const clockTimeT * time);
+
+/**
+ * @brief Termina la línea de la respuesta y la encola para transmitir.
+ *
+ * @param self  Puntero a la instancia de la consola.
+ * @param output  Puntero a la respuesta.
+ */
+static void Send(consoleT self, consoleOutputT * output);
+
+/**
+ * @brief Interpreta una hora con formato HH:MM o HH:MM:SS.
+ *
+ * @param text  Texto a interpretar.
+ * @param time  Puntero donde se almacena la hora en formato BCD, sin validar los rangos.
+ * @return true Si el texto tiene el formato esperado.
+ */
+static bool ParseTime(const char * text, clockTimeT * time);
+
+/**
+ * @brief Interpreta una fecha con formato AAAA-MM-DD.
+ *
+ * @param text  Texto a interpretar.
+ * @param date  Puntero donde se almacena la fecha, sin validar los rangos.
+ * @return true Si el texto tiene el formato esperado.
+ */
+static bool ParseDate(const char * text, calendarDateT * date);
+
+/**
+ * @brief Interpreta una cantidad fija de dígitos decimales.
+ *
+ * @param text  Texto a interpretar.
+ * @param digits  Cantidad de dígitos.
+ * @param value  Puntero donde se almacena el valor.
+ * @return true Si los caracteres son todos dígitos.
+ */
+static bool ParseDigits(const char * text, uint8_t digits, uint16_t * value);
+
+static bool CommandTime(consoleT self, const char * argument);
+static bool CommandDate(consoleT self, const char * argument);
+static bool CommandAlarm(consoleT self, const char * argument);
+static bool CommandStats(consoleT self, const char * argument);
+static bool CommandWatch(consoleT self, const char * argument);
+static bool CommandTrace(consoleT self, const char * argument);
+static bool CommandKeys(consoleT self, const char * argument);
+static bool CommandZone(consoleT self, const char * argument);
+
+/* === Private variable definitions ================================================================================ */
+
+static const consoleEntryT COMMANDS[] = {
+    {"time", CommandTime},   {"date", CommandDate},   {"alarm", CommandAlarm},
+    {"stats", CommandStats}, {"watch", CommandWatch}, {"trace", CommandTrace},
+    {"keys", CommandKeys},   {"zone", CommandZone},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ProcessChar(consoleT self, char data) {
+    if (data == '\r' || data == '\n') {
+        if (self->length > 0 || self->overflow) {
+            ExecuteLine(self);
+        }
+        self->length = 0;
+        self->overflow = false;
+    } else if ((data == '\b' || data == 0x7F) && self->length > 0) {
+        self->length--;
+    } else if (self->length < CONSOLE_LINE_SIZE - 1) {
+        self->line[self->length++] = data;
+    } else {
+        self->overflow = true; // El resto de la línea se descarta y se informa un error al terminarla
+    }
+}
+
+static void ExecuteLine(consoleT self) {
+    consoleOutputT output = {0};
+    const char * argument;
+    size_t length;
+    bool result = false;
+
+    self->line[self->length] = '\0';
+    argument = strchr(self->line, ' ');
+    length = argument ? (size_t)(argument - self->line) : self->length;
+    argument = argument ? argument + 1 : "";
+
+    for (size_t index = 0; !self->overflow && index < sizeof(COMMANDS) / sizeof(COMMANDS[0]); index++) {
+        if (strlen(COMMANDS[index].name) == length && !strncmp(COMMANDS[index].name, self->line, length)) {
+            result = COMMANDS[index].Execute(self, argument);
+            break;
+        }
+    }
+
+    self->commands++;
+    Append(&output, result ? "ok" : "error");
+    Send(self, &output);
+}
+
+static void Append(consoleOutputT * output, const char * text) {
+    while (*text && output->length < CONSOLE_OUTPUT_SIZE - 2) {
+        output->text[output->length++] = *text++;
+    }
+}
+
+static void AppendNumber(consoleOutputT * output, int32_t value, uint8_t width) {
+    char digits[11];
+    uint8_t count = 0;
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    if (value < 0) {
+        Append(output, "-");
+    }
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude && count < sizeof(digits));
+    while (count < width && count < sizeof(digits)) {
+        digits[count++] = '0';
+    }
+    while (count && output->length < CONSOLE_OUTPUT_SIZE - 2) {
+        output->text[output->length++] = digits[--count];
+    }
+}
+
+static void AppendHex(consoleOutputT * output, uint32_t value, uint8_t digits) {
+    static const char HEX[] = "0123456789ABCDEF";
+
+    while (digits-- && output->length < CONSOLE_OUTPUT_SIZE - 2) {
+        output->text[output->length++] = HEX[(value >> (4 * digits)) & 0x0F];
+    }
+}
+
+static void TransmitTrace(consoleT self) {
+    consoleOutputT output;
+    traceRecordT record;
+
+    while (self->tracing && self->driver->Free() >= CONSOLE_TRACE_SIZE) {
+        output.length = 0;
+        if (TraceRead(&self->traceCursor, &record, 1)) {
+            Append(&output, "trace ");
+            AppendHex(&output, record.timestamp, 8);
+            Append(&output, " ");
+            AppendHex(&output, record.event, 2);
+            Append(&output, " ");
+            AppendHex(&output, record.data, 4);
+        } else {
+            Append(&output, "trace end");
+            self->tracing = false;
+        }
+        Send(self, &output);
+    }
+}
+
+static void TransmitKeys(consoleT self) {
+    consoleOutputT output;
+    const uint16_t * entries;
+    uint16_t count = KeylogGetEntries(self->keylog, &entries);
+
+    while (self->dumpingKeys && self->driver->Free() >= CONSOLE_KEYS_SIZE) {
+        output.length = 0;
+        if (self->keysCursor < count) {
+            Append(&output, "keys");
+            for (uint8_t index = 0; index < CONSOLE_KEYS_LINE && self->keysCursor < count; index++) {
+                Append(&output, " ");
+                AppendHex(&output, entries[self->keysCursor++], 4);
+            }
+        } else {
+            Append(&output, "keys end");
+            self->dumpingKeys = false;
+        }
+        Send(self, &output);
+    }
+}
+
+static void AppendTime(consoleOutputT * output, const clockTimeT * time) {
+    char text[] = "00:00:00";
+
+    text[0] += time->bcd[5];
+    text[1] += time->bcd[4];
+    text[3] += time->bcd[3];
+    text[4] += time->bcd[2];
+    text[6] += time->bcd[1];
+    text[7] += time->bcd[0];
+    Append(output, text);
+}
+
+static void Send(consoleT self, consoleOutputT * output) {
+    output->text[output->length++] = '\r';
+    output->text[output->length++] = '\n';
+    self->dropped += output->length - self->driver->Write((const uint8_t *)output->text, output->length);
+}
+
+static bool ParseDigits(const char * text, uint8_t digits, uint16_t * value) {
+    *value = 0;
+    for (uint8_t index = 0; index < digits; index++) {
+        if (text[index] < '0' || text[index] > '9') {
+            return false;
+        }
+        *value = *value * 10 + (text[index] - '0');
+    }
+    return true;
+}
+
+static bool ParseTime(const char * text, clockTimeT * time) {
+    size_t length = strlen(text);
+    uint8_t digits = (length == 5) ? 4 : 6;
+
+    if ((length != 5 && length != 8) || text[2] != ':' || (length == 8 && text[5] != ':')) {
+        return false;
+    }
+    memset(time, 0, sizeof(clockTimeT));
+    // Los dígitos recibidos ya son la representación BCD que usa el reloj
+    const uint8_t positions[] = {0, 1, 3, 4, 6, 7};
+    for (uint8_t index = 0; index < digits; index++) {
+        char digit = text[positions[index]];
+        if (digit < '0' || digit > '9') {
+            return false;
+        }
+        time->bcd[5 - index] = digit - '0';
+    }
+    // El reloj invalida su configuración al recibir un valor fuera de rango, por eso se rechaza antes de aplicarlo
+    return time->time.hours[1] * 10 + time->time.hours[0] < 24 && time->time.minutes[1] < 6 &&
+           time->time.seconds[1] < 6;
+}
+
+static bool ParseDate(const char * text, calendarDateT * date) {
+    uint16_t year, month, day;
+
+    if (strlen(text) != 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+    if (!ParseDigits(text, 4, &year) || !ParseDigits(text + 5, 2, &month) || !ParseDigits(text + 8, 2, &day)) {
+        return false;
+    }
+    date->year = year;
+    date->month = month;
+    date->day = day;
+    return CalendarIsValid(date);
+}
+
+static bool CommandTime(consoleT self, const char * argument) {
+    consoleOutputT output = {0};
+    clockTimeT time;
+
+    if (*argument) {
+        if (!ParseTime(argument, &time) || !ClockSetTime(self->clock, &time)) {
+            return false;
+        }
+        if (self->changed) {
+            self->changed(self);
+        }
+        return true;
+    }
+
+    Append(&output, "time ");
+    if (ClockGetTime(self->clock, &time)) {
+        AppendTime(&output, &time);
+    } else {
+        Append(&output, "--:--:--");
+    }
+    Send(self, &output);
+    return true;
+}
+
+static bool CommandDate(consoleT self, const char * argument) {
+    consoleOutputT output = {0};
+    calendarDateT date;
+
+    if (*argument) {
+        if (!ParseDate(argument, &date) || !ClockSetDate(self->clock, &date)) {
+            return false;
+        }
+        if (self->changed) {
+            self->changed(self);
+        }
+        return true;
+    }
+
+    Append(&output, "date ");
+    if (ClockGetDate(self->clock, &date)) {
+        AppendNumber(&output, date.year, 4);
+        Append(&output, "-");
+        AppendNumber(&output, date.month, 2);
+        Append(&output, "-");
+        AppendNumber(&output, date.day, 2);
+    } else {
+        Append(&output, "----------");
+    }
+    Send(self, &output);
+    return true;
+}
+
+static bool CommandAlarm(consoleT self, const char * argument) {
+    consoleOutputT output = {0};
+    clockTimeT time;
+
+    if (!strcmp(argument, "on") || !strcmp(argument, "off")) {
+        if (!ClockGetAlarm(self->clock, &time)) {
+            return false; // No se puede habilitar una alarma que nunca se configuró
+        }
+        ClockAlarmAction(self->clock, argument[1] == 'n' ? ALARM_ENABLE : ALARM_DISABLE);
+    } else if (*argument) {
+        if (!ParseTime(argument, &time) || !ClockSetAlarm(self->clock, &time)) {
+            return false;
+        }
+    } else {
+        Append(&output, "alarm ");
+        if (ClockGetAlarm(self->clock, &time)) {
+            AppendTime(&output, &time);
+            Append(&output, ClockIsAlarmEnabled(self->clock) ? " on" : " off");
+        } else {
+            Append(&output, "--:--:--");
+        }
+        Send(self, &output);
+        return true;
+    }
+
+    if (self->changed) {
+        self->changed(self);
+    }
+    return true;
+}
+
+static bool CommandZone(consoleT self, const char * argument) {
+    consoleOutputT output = {0};
+    timezoneT previous = ClockGetTimezone(self->clock);
+    timezoneT zone;
+
+    if (*argument) {
+        zone = TimezoneCreate(argument);
+        if (!zone) {
+            return false;
+        }
+        // Se conserva la hora local, que es la que se configuró mirando un reloj de la zona
+        ClockSetTimezone(self->clock, zone);
+        TimezoneDestroy(previous);
+        if (self->changed) {
+            self->changed(self);
+        }
+        return true;
+    }
+
+    Append(&output, "zone ");
+    Append(&output, previous ? TimezoneGetDescription(previous) : "--");
+    Send(self, &output);
+    return true;
+}
+
+static bool CommandStats(consoleT self, const char * argument) {
+    consoleOutputT output = {0};
+    stackStatsT stack;
+    powerStatsT power;
+    syncStatsT sync;
+
+    (void)argument;
+    Append(&output, "utc ");
+    AppendNumber(&output, ClockGetUtc(self->clock), 1);
+    Append(&output, " offset ");
+    AppendNumber(&output, ClockGetUtcOffset(self->clock), 1);
+    Send(self, &output);
+
+    output.length = 0;
+    Append(&output, "ringing ");
+    Append(&output, ClockIsAlarmRinging(self->clock) ? "yes" : "no");
+    Append(&output, " snoozes ");
+    AppendNumber(&output, ClockGetSnoozeCount(self->clock), 1);
+    Send(self, &output);
+
+    output.length = 0;
+    if (StackMonitorGet(&stack)) {
+        Append(&output, "stack ");
+        AppendNumber(&output, stack.used, 1);
+        Append(&output, "/");
+        AppendNumber(&output, stack.size, 1);
+        Append(&output, " preempted ");
+        AppendNumber(&output, stack.preempted, 1);
+        Append(&output, " nesting ");
+        AppendNumber(&output, stack.nesting, 1);
+        Send(self, &output);
+    }
+
+    output.length = 0;
+    if (PowerGetStats(self->power, &power)) {
+        // La permanencia en cada nivel se informa en segundos, en el orden de powerLevels
+        Append(&output, "power");
+        for (uint8_t level = 0; level < POWER_LEVELS; level++) {
+            Append(&output, " ");
+            AppendNumber(&output, (int32_t)(power.residency[level] / 1000), 1);
+        }
+        Append(&output, " changes ");
+        AppendNumber(&output, power.transitions, 1);
+        Send(self, &output);
+    }
+
+    output.length = 0;
+    if (SyncGetStats(self->sync, &sync)) {
+        // El desfasaje se informa en microsegundos, la deriva y la corrección en partes por billón
+        Append(&output, "sync offset ");
+        AppendNumber(&output, sync.offset, 1);
+        Append(&output, " drift ");
+        AppendNumber(&output, sync.drift, 1);
+        Append(&output, " trim ");
+        AppendNumber(&output, sync.trim, 1);
+        Send(self, &output);
+
+        output.length = 0;
+        Append(&output, "sync samples ");
+        AppendNumber(&output, sync.samples, 1);
+        Append(&output, " steps ");
+        AppendNumber(&output, sync.steps, 1);
+        Append(&output, " errors ");
+        AppendNumber(&output, sync.errors, 1);
+        Send(self, &output);
+    }
+
+    output.length = 0;
+    Append(&output, "commands ");
+    AppendNumber(&output, self->commands, 1);
+    Append(&output, " dropped ");
+    AppendNumber(&output, self->dropped, 1);
+    Send(self, &output);
+    return true;
+}
+
+static bool CommandWatch(consoleT self, const char * argument) {
+    if (!strcmp(argument, "on")) {
+        self->watch = true;
+    } else if (!strcmp(argument, "off")) {
+        self->watch = false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool CommandTrace(consoleT self, const char * argument) {
+    if (*argument) {
+        return false;
+    }
+    // Los registros se transmiten desde el más antiguo en las llamadas siguientes a ConsolePoll
+    self->traceCursor = 0;
+    self->tracing = true;
+    return true;
+}
+
+static bool CommandKeys(consoleT self, const char * argument) {
+    uint16_t speed;
+
+    if (!self->keylog) {
+        return false;
+    }
+    if (!*argument) {
+        // Las entradas se transmiten tal como se guardan, el host las decodifica con KeylogDecode
+        self->keysCursor = 0;
+        self->dumpingKeys = true;
+    } else if (!strcmp(argument, "clear")) {
+        KeylogClear(self->keylog);
+    } else if (!strcmp(argument, "stop")) {
+        KeylogReplay(self->keylog, 0);
+    } else if (!strncmp(argument, "play ", 5) && strlen(argument + 5) >= 1 && strlen(argument + 5) <= 3 &&
+               ParseDigits(argument + 5, strlen(argument + 5), &speed) && speed >= 1 && speed <= UINT8_MAX) {
+        KeylogReplay(self->keylog, speed);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+consoleT ConsoleCreate(consoleDriverT driver, clockT clock, consoleChangedT changed) {
+    consoleT self = NULL;
+
+    // Los volcados consultan el espacio libre antes de cada línea, las tres funciones del driver son obligatorias
+    if (driver && driver->Read && driver->Write && driver->Free && clock) {
+        self = malloc(sizeof(struct consoleS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct consoleS));
+        self->driver = driver;
+        self->clock = clock;
+        self->changed = changed;
+    }
+    return self;
+}
+
+void ConsoleSetPower(consoleT self, powerT power) {
+    if (self) {
+        self->power = power;
+    }
+}
+
+void ConsoleSetSync(consoleT self, syncT sync) {
+    if (self) {
+        self->sync = sync;
+    }
+}
+
+void ConsoleSetKeylog(consoleT self, keylogT keylog) {
+    if (self) {
+        self->keylog = keylog;
+    }
+}
+
+void ConsolePoll(consoleT self) {
+    uint8_t data[CONSOLE_READ_SIZE];
+    uint16_t count;
+
+    if (!self) {
+        return;
+    }
+    do {
+        count = self->driver->Read(data, sizeof(data));
+        for (uint16_t index = 0; index < count; index++) {
+            ProcessChar(self, (char)data[index]);
+        }
+    } while (count == sizeof(data));
+    TransmitTrace(self);
+    TransmitKeys(self);
+}
+
+void ConsoleNotify(consoleT self, const char * event) {
+    consoleOutputT output = {0};
+
+    if (self && self->watch && event) {
+        Append(&output, "event ");
+        Append(&output, event);
+        Send(self, &output);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
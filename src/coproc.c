@@ -0,0 +1,174 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file coproc.c
+ ** @brief Implementación del barrido del display y el filtrado de las teclas en el núcleo Cortex-M0 del LPC4337
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "coproc.h"
+#include "hotpath.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define LOCAL_SRAM_START 0x10000000 //!< Comienzo de la SRAM local
+#define LOCAL_SRAM_END 0x10092000   //!< Final de la SRAM local, incluyendo el banco 2
+#define AHB_SRAM_START 0x20000000   //!< Comienzo de la SRAM AHB
+#define AHB_SRAM_END 0x20010000     //!< Final de la SRAM AHB
+
+//! Indica si una dirección está dentro de un rango, incluyendo el final porque la pila crece hacia abajo
+#define IN_RANGE(address, start, end) ((address) >= (start) && (address) <= (end))
+
+/* === Private data type declarations ============================================================================== */
+
+struct coprocS {
+    mailboxT mailbox;             //!< Buzón compartido con el núcleo principal
+    screenT screen;               //!< Pantalla que se barre
+    uint32_t sequence;            //!< Número de secuencia del último estado aplicado
+    screenStateT state;           //!< Copia del estado leído del buzón
+    uint32_t keys;                //!< Teclas filtradas, un bit por tecla
+    uint8_t count[COPROC_KEYS];   //!< Muestras consecutivas de cada tecla distintas de su estado filtrado
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+coprocT CoprocCreate(mailboxT mailbox, screenT screen) {
+    coprocT self;
+
+    if (!mailbox || !screen || sizeof(screenStateT) > sizeof(mailbox->frame)) {
+        return NULL;
+    }
+    self = malloc(sizeof(struct coprocS));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct coprocS));
+        self->mailbox = mailbox;
+        self->screen = screen;
+        if (mailbox->frameRate) {
+            ScreenSetFrameRate(screen, mailbox->frameRate);
+        }
+    }
+    return self;
+}
+
+uint8_t CoprocRefresh(coprocT self) {
+    if (MailboxFetch(self->mailbox, &self->state, sizeof(self->state), &self->sequence)) {
+        ScreenSetState(self->screen, &self->state);
+    }
+    return ScreenRefresh(self->screen);
+}
+
+bool CoprocSampleKeys(coprocT self, uint32_t raw) {
+    uint32_t changed = 0;
+
+    for (uint8_t key = 0; key < COPROC_KEYS; key++) {
+        if ((raw ^ self->keys) & (1UL << key)) {
+            self->count[key]++;
+            if (self->count[key] >= COPROC_DEBOUNCE) {
+                changed |= 1UL << key;
+                self->count[key] = 0;
+            }
+        } else {
+            self->count[key] = 0; // Un rebote reinicia la cuenta
+        }
+    }
+    if (changed) {
+        self->keys ^= changed;
+        self->mailbox->keys = self->keys;
+    }
+    return changed != 0;
+}
+
+bool CoprocPublish(mailboxT mailbox, screenT screen, screenStateT * published) {
+    screenStateT state;
+
+    if (!mailbox || !screen || !published) {
+        return false;
+    }
+    ScreenGetState(screen, &state);
+    if (memcmp(&state, published, sizeof(state)) == 0) {
+        return false;
+    }
+    memcpy(published, &state, sizeof(state));
+    return MailboxPublish(mailbox, &state, sizeof(state));
+}
+
+bool CoprocImageValid(const uint32_t vectors[]) {
+    uint32_t stack;
+    uint32_t reset;
+
+    if (!vectors) {
+        return false;
+    }
+    stack = vectors[0];
+    reset = vectors[1];
+    if ((stack & 0x7) != 0 ||
+        !(IN_RANGE(stack, LOCAL_SRAM_START, LOCAL_SRAM_END) || IN_RANGE(stack, AHB_SRAM_START, AHB_SRAM_END))) {
+        return false;
+    }
+    // El programa se puede enlazar en su dirección de la flash o en la dirección cero donde lo ve el Cortex-M0
+    if ((reset & 1) == 0) {
+        return false;
+    }
+    reset &= ~1UL;
+    return reset - COPROC_IMAGE_ADDRESS < COPROC_IMAGE_SIZE || reset < COPROC_IMAGE_SIZE;
+}
+
+bool CoprocScanTiming(coprocScanT * scan, uint16_t frameRate, uint16_t onTime, uint8_t digits) {
+    uint32_t slot;
+
+    if (!scan || frameRate == 0 || digits == 0) {
+        return false;
+    }
+    slot = 1000000UL / ((uint32_t)frameRate * digits);
+    if (onTime > slot) {
+        onTime = slot;
+    }
+    scan->unit = onTime / SCREEN_BRIGHTNESS_MAX;
+    scan->gap = slot - scan->unit * SCREEN_BRIGHTNESS_MAX;
+    if (scan->gap < 2) {
+        scan->gap = 0;
+    }
+    return scan->unit != 0;
+}
+
+HOT_PATH uint32_t CoprocScanSchedule(const coprocScanT * scan, uint8_t weight, uint32_t * blank) {
+    uint32_t period = weight * scan->unit;
+
+    *blank = UINT32_MAX;
+    if (weight == (SCREEN_BRIGHTNESS_MAX + 1) / 2 && scan->gap) {
+        *blank = period;
+        period += scan->gap;
+    }
+    return period - 1;
+}
+
+/* === End of documentation ======================================================================================== */
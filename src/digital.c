@@ -29,11 +29,36 @@ SPDX-License-Identifier: MIT
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#define DIGITAL_PWM_EDGES (DIGITAL_PWM_CHANNELS + 1) //!< El comienzo del período más un flanco por canal
+
 /* === Private data type declarations ============================================================================== */
 
+//! Representa un grupo de salidas de un mismo puerto
+struct digitalOutputGroupS {
+    uint8_t port;                          //!< Puerto de todas las salidas del grupo
+    uint8_t count;                         //!< Cantidad de salidas del grupo
+    uint32_t mask;                         //!< Valor del registro de máscara, en cero los pines del grupo
+    uint32_t inactive;                     //!< Nivel de los pines con todas las salidas inactivas
+    uint32_t bits[DIGITAL_GROUP_OUTPUTS];  //!< Pin de cada salida dentro del puerto
+};
+
+//! Flanco del PWM, desactiva al mismo tiempo todos los canales con el mismo ciclo de trabajo
+typedef struct digitalPwmEdgeS {
+    uint32_t time;     //!< Ticks desde el comienzo del período
+    uint32_t channels; //!< Canales que cambian en este flanco, un bit por canal
+} digitalPwmEdgeT;
+
+//! Tabla de flancos de un período, ordenada por tiempo
+typedef struct digitalPwmTableS {
+    uint8_t count;                          //!< Cantidad de flancos, el primero es el comienzo del período
+    uint8_t channels;                       //!< Canales asignados cuando se calculó la tabla
+    digitalPwmEdgeT edges[DIGITAL_PWM_EDGES]; //!< En el primero están los canales que se activan
+} digitalPwmTableT;
+
 //! Representa una salida digital
 struct digitalOutputS {
     uint8_t port; //!< Puerto al que pertenece la salida
@@ -43,20 +68,80 @@ struct digitalOutputS {
 
 //! Representa una entrada digital
 struct digitalInputS {
-    uint8_t port;   //!< Puerto al que pertenece la entrada
-    uint8_t pin;    //!< Pin al que pertenece la entrada
-    bool inverted;  //!< Indica si la entrada es invertida
-    bool lastState; //!< Estado anterior de la entrada
+    const volatile uint32_t * word; //!< Palabra de la que se lee la entrada, NULL si se lee del puerto
+    uint8_t port;                   //!< Puerto al que pertenece la entrada
+    uint8_t pin;                    //!< Pin al que pertenece la entrada, o bit de la palabra
+    bool inverted;                  //!< Indica si la entrada es invertida
+    bool lastState;                 //!< Estado anterior de la entrada
     
 };
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Calcula en la tabla inactiva los flancos de los ciclos de trabajo actuales y la marca para su uso.
+ */
+static void DigitalPwmBuild(void);
+
 /* === Private variable definitions ================================================================================ */
 
+static digitalOutputT pwmOutputs[DIGITAL_PWM_CHANNELS]; //!< Salidas asignadas a cada canal, no se liberan
+static uint8_t pwmDuty[DIGITAL_PWM_CHANNELS];           //!< Ciclo de trabajo de cada canal
+static uint8_t pwmChannels = 0;                         //!< Cantidad de canales asignados
+static uint32_t pwmPeriod = 0;                          //!< Período en ticks del temporizador
+
+static digitalPwmTableT pwmTables[2];       //!< Una tabla la usa la interrupción, la otra se calcula
+static uint8_t pwmActive = 0;               //!< Tabla que usa la interrupción
+static volatile bool pwmPending = false;    //!< Indica que la tabla inactiva está lista para usarse
+static uint8_t pwmEdge = 0;                 //!< Próximo flanco de la tabla activa
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void DigitalPwmBuild(void) {
+    digitalPwmTableT * table;
+    digitalPwmEdgeT edge;
+    uint8_t position;
+
+    // La interrupción solo cambia de tabla si hay una pendiente, mientras se calcula no se puede usar
+    pwmPending = false;
+    table = &pwmTables[pwmActive ^ 1];
+    table->channels = pwmChannels;
+    table->count = 1;
+    table->edges[0].time = 0;
+    table->edges[0].channels = 0;
+
+    for (uint8_t channel = 0; channel < pwmChannels; channel++) {
+        if (pwmDuty[channel] == 0) {
+            continue;
+        }
+        table->edges[0].channels |= 1UL << channel;
+        if (pwmDuty[channel] == DIGITAL_PWM_MAX) {
+            continue;
+        }
+        edge.time = (uint32_t)((uint64_t)pwmPeriod * pwmDuty[channel] / DIGITAL_PWM_MAX);
+        edge.channels = 1UL << channel;
+
+        // Inserción ordenada, los canales con el mismo tiempo comparten el flanco
+        position = table->count;
+        for (uint8_t index = 1; index < table->count; index++) {
+            if (table->edges[index].time >= edge.time) {
+                position = index;
+                break;
+            }
+        }
+        if (position < table->count && table->edges[position].time == edge.time) {
+            table->edges[position].channels |= edge.channels;
+        } else {
+            memmove(&table->edges[position + 1], &table->edges[position],
+                    (table->count - position) * sizeof(digitalPwmEdgeT));
+            table->edges[position] = edge;
+            table->count++;
+        }
+    }
+    pwmPending = true;
+}
+
 /* === Public function implementation ============================================================================== */
 
 digitalOutputT DigitalOutputCreate(uint8_t port, uint8_t pin, bool state) {
@@ -85,9 +170,137 @@ void DigitalOutputToggle(digitalOutputT self) {
     Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->port, self->pin);
 }
 
+digitalOutputGroupT DigitalOutputGroupCreate(const digitalOutputT outputs[], uint8_t count) {
+    digitalOutputGroupT self;
+
+    if (!outputs || count == 0 || count > DIGITAL_GROUP_OUTPUTS) {
+        return NULL;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if (!outputs[index] || outputs[index]->port != outputs[0]->port) {
+            return NULL;
+        }
+    }
+
+    self = malloc(sizeof(struct digitalOutputGroupS));
+    if (self != NULL) {
+        self->port = outputs[0]->port;
+        self->count = count;
+        self->mask = UINT32_MAX;
+        self->inactive = 0;
+        for (uint8_t index = 0; index < count; index++) {
+            self->bits[index] = 1UL << outputs[index]->pin;
+            self->mask &= ~self->bits[index];
+            if (outputs[index]->state) {
+                self->inactive |= self->bits[index];
+            }
+        }
+    }
+    return self;
+}
+
+uint32_t DigitalOutputGroupPattern(digitalOutputGroupT self, uint32_t active) {
+    uint32_t pattern = 0;
+
+    if (!self) {
+        return 0;
+    }
+    // Una salida activa tiene el nivel opuesto al inactivo, así se cubren las salidas de lógica invertida
+    for (uint8_t index = 0; index < self->count; index++) {
+        if (active & (1UL << index)) {
+            pattern |= self->bits[index];
+        }
+    }
+    return pattern ^ self->inactive;
+}
+
+void DigitalOutputGroupWrite(digitalOutputGroupT self, uint32_t pattern) {
+    if (self) {
+        Chip_GPIO_SetPortMask(LPC_GPIO_PORT, self->port, self->mask);
+        Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, self->port, pattern);
+    }
+}
+
+void DigitalOutputGroupSet(digitalOutputGroupT self, uint32_t active) {
+    DigitalOutputGroupWrite(self, DigitalOutputGroupPattern(self, active));
+}
+
+bool DigitalPwmInit(uint32_t period) {
+    if (period < DIGITAL_PWM_MAX) {
+        return false; // Cada paso del ciclo de trabajo debe durar al menos un tick
+    }
+    pwmPeriod = period;
+    pwmChannels = 0;
+    pwmEdge = 0;
+    DigitalPwmBuild();
+    return true;
+}
+
+bool DigitalOutputSetDuty(digitalOutputT self, uint8_t duty) {
+    uint8_t channel;
+
+    if (!self || pwmPeriod == 0) {
+        return false;
+    }
+    for (channel = 0; channel < pwmChannels; channel++) {
+        if (pwmOutputs[channel] == self) {
+            break;
+        }
+    }
+    if (channel == pwmChannels) {
+        if (pwmChannels == DIGITAL_PWM_CHANNELS) {
+            return false;
+        }
+        pwmOutputs[channel] = self;
+        pwmDuty[channel] = duty;
+        pwmChannels++; // El canal queda visible para la interrupción recién cuando está completo
+    } else if (pwmDuty[channel] == duty) {
+        return true;
+    }
+    pwmDuty[channel] = duty;
+    DigitalPwmBuild();
+    return true;
+}
+
+uint32_t DigitalPwmUpdate(void) {
+    const digitalPwmTableT * table;
+    const digitalPwmEdgeT * edge;
+    uint32_t next;
+
+    if (pwmEdge == 0 && pwmPending) {
+        pwmActive ^= 1;
+        pwmPending = false;
+    }
+    table = &pwmTables[pwmActive];
+    edge = &table->edges[pwmEdge];
+
+    for (uint8_t channel = 0; channel < table->channels; channel++) {
+        if (pwmEdge == 0) {
+            // Al comenzar el período también se desactivan los canales en cero, por si venían de otro ciclo
+            if (edge->channels & (1UL << channel)) {
+                DigitalOutputActivate(pwmOutputs[channel]);
+            } else {
+                DigitalOutputDesactivate(pwmOutputs[channel]);
+            }
+        } else if (edge->channels & (1UL << channel)) {
+            DigitalOutputDesactivate(pwmOutputs[channel]);
+        }
+    }
+
+    pwmEdge++;
+    if (pwmEdge >= table->count) {
+        pwmEdge = 0;
+        next = pwmPeriod;
+    } else {
+        next = table->edges[pwmEdge].time;
+    }
+    return next - edge->time;
+}
+
 digitalInputT DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted) {
     digitalInputT self = malloc(sizeof(struct digitalInputS));
     if (self != NULL) {
+        self->word = NULL;
         self->port = port;
         self->pin = pin;
         self->inverted = inverted;
@@ -100,8 +313,32 @@ digitalInputT DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted) {
     return self;
 }
 
+digitalInputT DigitalInputCreateWord(const volatile uint32_t * word, uint8_t bit, bool inverted) {
+    digitalInputT self;
+
+    if (!word || bit >= 32) {
+        return NULL;
+    }
+    self = malloc(sizeof(struct digitalInputS));
+    if (self != NULL) {
+        self->word = word;
+        self->port = 0;
+        self->pin = bit;
+        self->inverted = inverted;
+        self->lastState = DigitalInputGetActivate(self);
+    }
+
+    return self;
+}
+
 bool DigitalInputGetActivate(digitalInputT self) {
-    bool state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->port, self->pin);
+    bool state;
+
+    if (self->word) {
+        state = (*self->word >> self->pin) & 1;
+    } else {
+        state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->port, self->pin);
+    }
 
     if (self->inverted) {
         return !state;
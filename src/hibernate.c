@@ -0,0 +1,138 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file hibernate.c
+ ** @brief Implementación de la copia del estado del reloj en memoria retenida durante el apagado profundo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hibernate.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define IMAGE_MAGIC     0x48494245 //!< Marca que identifica un estado guardado por HibernateEnter
+#define SECONDS_PER_DAY 86400UL    //!< Segundos de un día
+
+//! Cantidad de palabras retenidas que ocupa el estado guardado
+#define IMAGE_WORDS (sizeof(hibernateImageT) / sizeof(uint32_t))
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado guardado, ocupa un número entero de palabras para copiarlo de a una
+typedef union hibernateImageU {
+    struct {
+        uint32_t magic;    //!< Marca de estado guardado
+        clockStateT clock; //!< Estado del reloj al apagar
+        uint32_t mode;     //!< Modo de la interfaz al apagar
+        uint32_t check;    //!< Suma de verificación de todos los campos anteriores
+    } fields;
+    uint32_t words[8];
+} hibernateImageT;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la suma de verificación de las palabras del estado guardado, sin incluir la propia suma.
+ *
+ * @param image  Puntero al estado guardado.
+ * @return uint32_t Suma calculada.
+ */
+static uint32_t Checksum(const hibernateImageT * image);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Checksum(const hibernateImageT * image) {
+    uint32_t check = 0;
+
+    // La rotación hace que el orden de las palabras también cambie el resultado
+    for (uint8_t index = 0; index < offsetof(hibernateImageT, fields.check) / sizeof(uint32_t); index++) {
+        check = (check << 5 | check >> 27) ^ image->words[index];
+    }
+    return check;
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool HibernateEnter(hibernateDriverT driver, const clockStateT * clock, uint8_t mode) {
+    hibernateImageT image;
+    uint32_t wake = 0;
+
+    if (!driver || !clock || driver->words < IMAGE_WORDS) {
+        return false;
+    }
+    if (clock->flags & CLOCK_STATE_SNOOZED) {
+        return false; // El despertador solo cubre la hora de la alarma, la posposición se perdería
+    }
+    if ((clock->flags & CLOCK_STATE_VALID_TIME) && (clock->flags & CLOCK_STATE_VALID_ALARM) &&
+        (clock->flags & CLOCK_STATE_ALARM_ENABLED)) {
+        wake = (clock->alarmSeconds + SECONDS_PER_DAY - clock->seconds) % SECONDS_PER_DAY;
+        if (wake <= HIBERNATE_WAKE_MARGIN) {
+            return false; // La alarma suena antes de que el reloj vuelva a funcionar
+        }
+        wake -= HIBERNATE_WAKE_MARGIN;
+    }
+
+    memset(&image, 0, sizeof(image));
+    image.fields.magic = IMAGE_MAGIC;
+    image.fields.clock = *clock;
+    image.fields.mode = mode;
+    image.fields.check = Checksum(&image);
+    for (uint8_t index = 0; index < IMAGE_WORDS; index++) {
+        driver->Write(index, image.words[index]);
+    }
+
+    driver->PowerDown(wake);
+    return true;
+}
+
+bool HibernateRestore(hibernateDriverT driver, clockStateT * clock, uint8_t * mode) {
+    hibernateImageT image;
+    uint32_t seconds;
+
+    if (!driver || !clock || !mode || driver->words < IMAGE_WORDS) {
+        return false;
+    }
+    for (uint8_t index = 0; index < IMAGE_WORDS; index++) {
+        image.words[index] = driver->Read(index);
+    }
+    if (image.fields.magic != IMAGE_MAGIC || image.fields.check != Checksum(&image)) {
+        return false; // Arranque normal o memoria retenida sin alimentación
+    }
+    driver->Write(offsetof(hibernateImageT, fields.magic) / sizeof(uint32_t), 0);
+
+    *clock = image.fields.clock;
+    *mode = image.fields.mode;
+    if (clock->flags & CLOCK_STATE_VALID_TIME) {
+        // El reloj no avanzó mientras el equipo estuvo apagado, se suma el tiempo medido por el driver
+        seconds = clock->seconds + driver->Elapsed();
+        clock->days += seconds / SECONDS_PER_DAY;
+        clock->seconds = seconds % SECONDS_PER_DAY;
+    }
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
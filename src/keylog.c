@@ -0,0 +1,240 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file keylog.c
+ ** @brief Implementación de la captura y reproducción de los cambios de las teclas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "keylog.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/*
+ * Cada entrada ocupa 16 bits: el bit 15 indica si la tecla se presionó, los bits 14 a 12 la tecla y los bits 11 a 0
+ * los milisegundos desde el cambio anterior. Los tiempos mayores se completan con entradas de pausa previas, con la
+ * tecla KEYLOG_KEYS, que suman su valor en unidades de 4096 ms.
+ */
+#define ENTRY_PRESSED    0x8000      //!< Bit que indica que la tecla se presionó
+#define ENTRY_KEY_SHIFT  12          //!< Posición del campo de la tecla
+#define ENTRY_KEY_MASK   0x07        //!< Máscara del campo de la tecla, después de desplazarlo
+#define ENTRY_DELTA_MASK 0x0FFF      //!< Máscara del campo de tiempo
+#define ENTRY_GAP        KEYLOG_KEYS //!< Tecla de las entradas de pausa
+#define ENTRY_GAP_SHIFT  12          //!< Milisegundos de cada unidad de las pausas, como potencia de dos
+
+#define KEYS_MASK ((1u << KEYLOG_KEYS) - 1) //!< Bits de la palabra de teclas que se capturan
+
+/* === Private data type declarations ============================================================================== */
+
+struct keylogS {
+    uint16_t * entries; //!< Entradas del registro
+    uint16_t capacity;  //!< Cantidad máxima de entradas
+    uint16_t count;     //!< Cantidad de entradas ocupadas
+    bool capturing;     //!< Indica si se registran los cambios
+    bool timed;         //!< Indica si ya se tomó el instante de inicio de la captura
+    uint32_t keys;      //!< Teclas presionadas en la captura anterior
+    uint32_t last;      //!< Instante del último cambio registrado
+    uint8_t speed;      //!< Velocidad de la reproducción en curso, cero si no se reproduce
+    bool started;       //!< Indica si ya se tomó el instante de inicio de la reproducción
+    bool pending;       //!< Indica si queda un cambio por reproducir
+    uint32_t start;     //!< Instante de inicio de la reproducción
+    uint16_t cursor;    //!< Próxima entrada a decodificar en la reproducción
+    uint32_t time;      //!< Instante del último cambio decodificado en la reproducción
+    keylogEventT next;  //!< Próximo cambio a reproducir
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega un cambio al registro, precedido por las entradas de pausa que necesite su tiempo.
+ *
+ * @param self  Puntero a la instancia del registro.
+ * @param key  Tecla que cambió.
+ * @param pressed  Indica si la tecla se presionó.
+ * @param now  Instante del cambio.
+ * @return true Si el cambio entra completo en el registro.
+ */
+static bool Append(keylogT self, uint8_t key, bool pressed, uint32_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool Append(keylogT self, uint8_t key, bool pressed, uint32_t now) {
+    uint32_t delta = now - self->last;
+    uint32_t gaps = delta >> ENTRY_GAP_SHIFT;
+    uint32_t chunk;
+
+    // El cambio se registra completo o no se registra, para no dejar pausas sin su cambio
+    if (self->count + (gaps + ENTRY_DELTA_MASK - 1) / ENTRY_DELTA_MASK + 1 > self->capacity) {
+        return false;
+    }
+    while (gaps) {
+        chunk = gaps < ENTRY_DELTA_MASK ? gaps : ENTRY_DELTA_MASK;
+        self->entries[self->count++] = ENTRY_GAP << ENTRY_KEY_SHIFT | chunk;
+        gaps -= chunk;
+    }
+    self->entries[self->count++] = (pressed ? ENTRY_PRESSED : 0) | key << ENTRY_KEY_SHIFT | (delta & ENTRY_DELTA_MASK);
+    self->last = now;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+keylogT KeylogCreate(uint16_t capacity) {
+    keylogT self = NULL;
+
+    if (capacity) {
+        self = malloc(sizeof(struct keylogS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct keylogS));
+        self->entries = malloc(capacity * sizeof(uint16_t));
+        if (self->entries == NULL) {
+            free(self);
+            return NULL;
+        }
+        self->capacity = capacity;
+        KeylogClear(self);
+    }
+    return self;
+}
+
+void KeylogClear(keylogT self) {
+    if (self) {
+        self->count = 0;
+        self->keys = 0;
+        self->timed = false;
+        self->capturing = true;
+    }
+}
+
+bool KeylogCapture(keylogT self, uint32_t keys, uint32_t now) {
+    uint32_t changed;
+
+    if (!self || !self->capturing) {
+        return false;
+    }
+    if (self->speed) {
+        self->timed = false; // El tiempo de la reproducción no se suma al del próximo cambio capturado
+        return true;
+    }
+    if (!self->timed) {
+        self->timed = true;
+        self->last = now;
+    }
+    changed = (keys ^ self->keys) & KEYS_MASK;
+    for (uint8_t key = 0; changed; key++) {
+        if (changed & (1u << key)) {
+            if (!Append(self, key, keys & (1u << key), now)) {
+                self->capturing = false; // Se conserva el principio de la sesión, que lleva al estado observado
+                return false;
+            }
+            self->keys ^= 1u << key;
+            changed &= ~(1u << key);
+        }
+    }
+    return true;
+}
+
+uint16_t KeylogGetEntries(keylogT self, const uint16_t ** entries) {
+    if (!self || !entries) {
+        return 0;
+    }
+    *entries = self->entries;
+    return self->count;
+}
+
+bool KeylogLoad(keylogT self, const uint16_t entries[], uint16_t count) {
+    if (!self || !entries || count > self->capacity) {
+        return false;
+    }
+    memcpy(self->entries, entries, count * sizeof(uint16_t));
+    self->count = count;
+    self->capturing = false;
+    return true;
+}
+
+bool KeylogDecode(const uint16_t entries[], uint16_t count, uint16_t * cursor, uint32_t * time,
+                  keylogEventT * event) {
+    uint16_t entry;
+    uint8_t key;
+
+    if (!entries || !cursor || !time || !event) {
+        return false;
+    }
+    while (*cursor < count) {
+        entry = entries[(*cursor)++];
+        key = (entry >> ENTRY_KEY_SHIFT) & ENTRY_KEY_MASK;
+        if (key == ENTRY_GAP) {
+            *time += (uint32_t)(entry & ENTRY_DELTA_MASK) << ENTRY_GAP_SHIFT;
+        } else {
+            *time += entry & ENTRY_DELTA_MASK;
+            event->time = *time;
+            event->key = key;
+            event->pressed = entry & ENTRY_PRESSED;
+            return true;
+        }
+    }
+    return false;
+}
+
+void KeylogReplay(keylogT self, uint8_t speed) {
+    if (self) {
+        self->speed = speed;
+        self->started = false;
+        self->cursor = 0;
+        self->time = 0;
+    }
+}
+
+bool KeylogReplayPoll(keylogT self, uint32_t now, volatile uint32_t * keys) {
+    if (!self || !keys || !self->speed) {
+        return false;
+    }
+    if (!self->started) {
+        self->started = true;
+        self->start = now;
+        *keys = 0;
+        self->pending = KeylogDecode(self->entries, self->count, &self->cursor, &self->time, &self->next);
+    }
+    if (!self->pending) {
+        self->speed = 0; // El último cambio se aplicó en la llamada anterior
+        return false;
+    }
+    // El cambio se aplica cuando el tiempo transcurrido multiplicado por la velocidad alcanza su instante
+    if (now - self->start >= (self->next.time + self->speed - 1) / self->speed) {
+        if (self->next.pressed) {
+            *keys |= 1u << self->next.key;
+        } else {
+            *keys &= ~(1u << self->next.key);
+        }
+        self->pending = KeylogDecode(self->entries, self->count, &self->cursor, &self->time, &self->next);
+    }
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
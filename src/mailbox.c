@@ -0,0 +1,126 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file mailbox.c
+ ** @brief Implementación del buzón en memoria compartida entre los dos núcleos del LPC4337
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "mailbox.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifdef __ARM_ARCH
+//! Completa los accesos a memoria anteriores antes de los siguientes, vistos desde el otro núcleo
+#define MAILBOX_BARRIER() __asm volatile("dmb" ::: "memory")
+#else
+#define MAILBOX_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula cuántos bytes del cuadro ocupan la palabra que comienza en una posición.
+ *
+ * @param size      Cantidad de bytes del cuadro.
+ * @param offset    Posición de la palabra, múltiplo de cuatro.
+ * @return uint16_t Cuatro, o menos si es la última palabra de un cuadro de tamaño no múltiplo de cuatro.
+ */
+static uint16_t WordBytes(uint16_t size, uint16_t offset);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t WordBytes(uint16_t size, uint16_t offset) {
+    uint16_t count = size - offset;
+    return (count < sizeof(uint32_t)) ? count : sizeof(uint32_t);
+}
+
+/* === Public function implementation ============================================================================== */
+
+void MailboxInit(mailboxT self, uint16_t frameRate, uint16_t onTime) {
+    if (!self) {
+        return; // Protección ante NULL
+    }
+    self->frameRate = frameRate;
+    self->onTime = onTime;
+    self->keys = 0;
+    self->sequence = 0;
+    for (uint8_t index = 0; index < MAILBOX_FRAME_WORDS; index++) {
+        self->frame[index] = 0;
+    }
+    MAILBOX_BARRIER();
+}
+
+bool MailboxPublish(mailboxT self, const void * data, uint16_t size) {
+    const uint8_t * source = data;
+    uint32_t sequence;
+    uint32_t word;
+
+    if (!self || !data || size > sizeof(self->frame)) {
+        return false;
+    }
+    sequence = self->sequence + 1;
+    self->sequence = sequence; // Impar, el lector descarta lo que copie desde ahora
+    MAILBOX_BARRIER();
+    for (uint16_t offset = 0; offset < size; offset += sizeof(word)) {
+        word = 0;
+        memcpy(&word, source + offset, WordBytes(size, offset));
+        self->frame[offset / sizeof(word)] = word;
+    }
+    MAILBOX_BARRIER();
+    self->sequence = sequence + 1;
+    return true;
+}
+
+bool MailboxFetch(mailboxT self, void * data, uint16_t size, uint32_t * sequence) {
+    uint8_t * destination = data;
+    uint32_t current;
+    uint32_t word;
+
+    if (!self || !data || !sequence || size > sizeof(self->frame)) {
+        return false;
+    }
+    current = self->sequence;
+    if (current == *sequence || (current & 1)) {
+        return false; // Sin cambios o con una escritura en curso
+    }
+    MAILBOX_BARRIER();
+    for (uint16_t offset = 0; offset < size; offset += sizeof(word)) {
+        word = self->frame[offset / sizeof(word)];
+        memcpy(destination + offset, &word, WordBytes(size, offset));
+    }
+    MAILBOX_BARRIER();
+    if (self->sequence != current) {
+        return false; // El productor publicó otro cuadro durante la copia
+    }
+    *sequence = current;
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -40,28 +40,52 @@
 
 /* === Headers files inclusions =============================================================== */
 
+#include "app.h"
 #include "bsp.h"
 #include "clock.h"
+#include "console.h"
+#include "cycles.h"
+#include "hibernate.h"
+#include "keylog.h"
+#include "power.h"
+#include "hotpath.h"
+#include "sound.h"
+#include "sync.h"
+#include "stack.h"
+#include "trace.h"
+#include "timezone.h"
 #include <stdbool.h>
+#include <string.h>
 
 /* === Macros definitions ====================================================================== */
 
-#define TOGGLE_DOT()                                                                                                   \
-    ScreenToggleDot(board->screen, 0);                                                                                 \
-    ScreenToggleDot(board->screen, 1);                                                                                 \
-    ScreenToggleDot(board->screen, 2);                                                                                 \
-    ScreenToggleDot(board->screen, 3);
+/*
+ * La EEPROM solo programa páginas completas de 128 bytes y cada programación borra la página, así que cada guardado
+ * desgasta una página entera aunque el registro ocupe la mitad de ella. Agrupar los registros no cambia el desgaste,
+ * el log circular lo reparte sobre las 127 páginas: con unos 100000 ciclos por página entran unos 12 millones de
+ * guardados, más de 200 años con este período pero menos de cinco meses si se guardara cada segundo.
+ */
+#define SAVE_TIME_PERIOD 600000 //!< Milisegundos entre cada guardado periódico de la hora en la EEPROM
+#define CYCLES_PERIOD    10000  //!< Milisegundos entre cada registro de los ciclos de las interrupciones
 
-/* === Private data type declarations ========================================================== */
+#ifndef KEYLOG_ENTRIES
+#define KEYLOG_ENTRIES 512 //!< Entradas del registro de teclas, cada cambio de una tecla ocupa una entrada
+#endif
+
+#ifndef HIBERNATE_IDLE
+#define HIBERNATE_IDLE 0 //!< Milisegundos mostrando la hora sin tocar las teclas antes de hibernar, cero no hiberna
+#endif
 
-typedef enum clockStates {
-    UNCONFIGURED,        //!< Hora no válida al iniciar el reloj.
-    SHOW_TIME,           //!< Muestra la hora actual.
-    SET_CURRENT_MINUTES, //!< Establece los minutos actuales.
-    SET_CURRENT_HOURS,   //!< Establece la hora actual.
-    SET_ALARM_MINUTES,   //!< Establece los minutos de la alarma.
-    SET_ALARM_HOURS,     //!< Establece la hora de la alarma.
-} clockStates;
+#define POWER_DIM_IDLE       300000  //!< Milisegundos sin actividad antes de atenuar el display
+#define POWER_BLANK_IDLE     1800000 //!< Milisegundos sin actividad antes de apagar el display
+#define POWER_SLOW_IDLE      1810000 //!< Milisegundos sin actividad antes de hacer más lento el SysTick
+#define POWER_DIM_BRIGHTNESS 1       //!< Brillo máximo del display atenuado
+#define POWER_SLOW_TICKS     10      //!< Milisegundos que cubre cada interrupción del SysTick con el tick lento
+
+#define DISPLAY_FRAME_RATE 250  //!< Cuadros por segundo del barrido del display
+#define DISPLAY_ON_TIME    1000 //!< Microsegundos de encendido de cada dígito en cada cuadro
+
+/* === Private data type declarations ========================================================== */
 
 typedef enum buttonStates{
     IDLE,
@@ -69,271 +93,322 @@ typedef enum buttonStates{
     LONG_PRESSED,
 } buttonStates;
 
+//! Configuración que se guarda en la EEPROM, la zona horaria no forma parte del estado del reloj
+typedef struct settingsS {
+    clockStateT clock;                    //!< Hora, alarma y configuración del reloj
+    char zone[TIMEZONE_DESCRIPTION_SIZE]; //!< Descripción de la zona horaria, vacía si la hora local es UTC
+} settingsT;
+
 /* === Private variable declarations =========================================================== */
 
+//! Tiempos sin actividad de cada nivel de consumo
+static const uint32_t POWER_TIMEOUTS[POWER_LEVELS] = {
+    [POWER_DIMMED] = POWER_DIM_IDLE,
+    [POWER_BLANK] = POWER_BLANK_IDLE,
+    [POWER_SLOW] = POWER_SLOW_IDLE,
+};
+
+//! Un pitido corto por segundo
+static const soundNoteT ALARM_SOFT[] = {{SOUND_A7, 10}, {SOUND_REST, 90}};
+
+//! Dos pitidos por segundo
+static const soundNoteT ALARM_DOUBLE[] = {{SOUND_A7, 10}, {SOUND_REST, 10}, {SOUND_A7, 10}, {SOUND_REST, 70}};
+
+//! Arpegio continuo mientras nadie atienda la alarma
+static const soundNoteT ALARM_URGENT[] = {
+    {SOUND_C7, 8}, {SOUND_E7, 8}, {SOUND_G7, 8}, {SOUND_A7, 16}, {SOUND_REST, 10},
+};
+
+//! La alarma escala cada treinta segundos hasta el arpegio continuo
+static const soundPatternT ALARM_MELODY[] = {
+    SOUND_PATTERN(ALARM_SOFT, 30),
+    SOUND_PATTERN(ALARM_DOUBLE, 30),
+    SOUND_PATTERN(ALARM_URGENT, 0),
+};
+
 /* === Private function declarations =========================================================== */
 
 /* === Public variable definitions ============================================================= */
 
 boardT board;
 clockT clock;
-clockStates mode;
-uint8_t digits[4];
-bool dotsOn = false;
+consoleT console;
+syncT sync;
+powerT power;
+appT app;
+keylogT keylog;
 
 buttonStates SetTimeState = IDLE;
 volatile uint32_t mseg = 0; // Variable para el tiempo en milisegundos
 
 /* === Private variable definitions ============================================================ */
 
+static volatile uint32_t tickMaxCycles; //!< Ciclos del núcleo consumidos por la interrupción más larga del SysTick
+
+static digitalInputT keys[APP_KEYS]; //!< Tecla de la placa que corresponde a cada tecla de la interfaz
+
+static volatile uint32_t replayKeys;         //!< Teclas presionadas por la reproducción del registro de teclas
+static digitalInputT replayInputs[APP_KEYS]; //!< Entradas que leen las teclas reproducidas, en lugar de la placa
+
 /* === Private function implementation ========================================================= */
 void AlarmRinging(clockT clock) {
-    DigitalOutputActivate(board->ledRed);
+    AppAlarmRinging(app);
 }
 
-void GetHourMinuteBCD(clockTimeT * time, uint8_t digits[]) {
-    if (time && digits) {
-        digits[0] = time->bcd[5]; // Hora de decenas
-        digits[1] = time->bcd[4]; // Hora de unidades
-        digits[2] = time->bcd[3]; // Minuto de decenas
-        digits[3] = time->bcd[2]; // Minuto de unidades
+void RingingLed(bool on) {
+    if (on) {
+        DigitalOutputActivate(board->ledRed);
+    } else {
+        DigitalOutputDesactivate(board->ledRed);
     }
 }
 
-void SetHourMinuteBCD(clockTimeT * time, uint8_t digits[]) {
-    if (time && digits) {
-        time->bcd[5] = digits[0]; // Hora de decenas
-        time->bcd[4] = digits[1]; // Hora de unidades
-        time->bcd[3] = digits[2]; // Minuto de decenas
-        time->bcd[2] = digits[3]; // Minuto de unidades
-        time->bcd[1] = 0;
-        time->bcd[0] = 0;
-    }
+void AlarmLed(uint8_t duty) {
+    DigitalOutputSetDuty(board->ledGreen, duty);
 }
 
-void ChangeMode(clockStates value) {
-    mode = value;
-
-    switch (mode) {
-    case UNCONFIGURED:
-        ScreenFlashDigits(board->screen, 0, 3, 100);
-        break;
-
-    case SHOW_TIME:
-        ScreenFlashDigits(board->screen, 0, 0, 0);
-
-        // Apagar los puntos si estaban encendidos
-        if (dotsOn) {
-            TOGGLE_DOT();
-            dotsOn = false;
-        }
-        break;
+void AlarmSound(bool play) {
+    if (play) {
+        SoundPlay(board->sound, ALARM_MELODY, sizeof(ALARM_MELODY) / sizeof(ALARM_MELODY[0]));
+    } else {
+        SoundStop(board->sound);
+    }
+}
 
-    case SET_CURRENT_MINUTES:
-        ScreenFlashDigits(board->screen, 2, 3, 100);
-        break;
+void NotifyEvent(const char * event) {
+    ConsoleNotify(console, event);
+}
 
-    case SET_CURRENT_HOURS:
-        ScreenFlashDigits(board->screen, 0, 1, 100);
-        break;
+void SaveState(const clockStateT * state) {
+    settingsT settings = {0};
+    timezoneT zone = ClockGetTimezone(clock);
 
-    case SET_ALARM_MINUTES:
-        ScreenFlashDigits(board->screen, 2, 3, 100);
-        if (!dotsOn) {
-            TOGGLE_DOT();
-            dotsOn = true;
-        }
-        break;
+    settings.clock = *state;
+    if (zone) {
+        strcpy(settings.zone, TimezoneGetDescription(zone));
+    }
+    StorageSave(board->storage, &settings, sizeof(settings), mseg);
+}
 
-    case SET_ALARM_HOURS:
-        ScreenFlashDigits(board->screen, 0, 1, 100);
-        if (!dotsOn) {
-            TOGGLE_DOT();
-            dotsOn = true;
-        }
-        break;
+void SaveSettings(void) {
+    clockStateT state;
 
-    default:
-        break;
+    if (ClockGetState(clock, &state)) {
+        SaveState(&state);
     }
 }
 
-// Función auxiliar para obtener el máximo valor de unidades según las decenas
-uint8_t GetMaxUnits(uint8_t tens, uint8_t max_tens, uint8_t max_units) {
-    if (tens == max_tens) {
-        // Caso especial: para horas, si tens=2, max_units=3
-        // Para minutos, si tens=5, max_units=9
-        return (max_tens == 2) ? 3 : 9; // Asume horas si max_tens=2
+bool RestoreSettings(settingsT * settings) {
+    if (!StorageRestore(board->storage, settings, sizeof(*settings))) {
+        return false;
     }
-    return 9; // Para decenas normales, unidades van de 0-9
+    // La zona se asigna antes que la hora, que se guarda como hora local
+    settings->zone[sizeof(settings->zone) - 1] = '\0';
+    ClockSetTimezone(clock, TimezoneCreate(settings->zone));
+    return true;
+}
+
+void ConsoleChanged(consoleT console) {
+    AppRemoteChanged(app);
+}
+
+uint16_t Saturate(uint32_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : value;
 }
 
-void BcdIncrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens) {
-    (*units)++;
+void TraceCycles(void) {
+    displayScanStatsT scan;
 
-    // Obtener el límite real de unidades para la decena actual
-    uint8_t current_max_units = GetMaxUnits(*tens, max_tens, max_units);
+    // Permite comparar las interrupciones ejecutadas desde la flash y desde la RAM con el mismo registro de eventos
+    DisplayScanGetStats(&scan);
+    TraceRecord(TRACE_TICK_CYCLES, Saturate(tickMaxCycles));
+    TraceRecord(TRACE_SCAN_CYCLES, Saturate(scan.maxCycles));
+}
 
-    if (*units > current_max_units) {
-        *units = 0;
-        (*tens)++;
+uint32_t KeysPressed(const digitalInputT inputs[]) {
+    uint32_t pressed = 0;
 
-        if (*tens > max_tens) {
-            *tens = 0;
-            *units = 0;
+    for (int key = 0; key < APP_KEYS; key++) {
+        if (DigitalInputGetActivate(inputs[key])) {
+            pressed |= 1 << key;
         }
     }
+    return pressed;
 }
 
-void BcdDecrement(uint8_t * units, uint8_t * tens, uint8_t max_units, uint8_t max_tens) {
-    if (*units > 0) {
-        (*units)--;
+void KeysResync(const digitalInputT inputs[]) {
+    // Lee el estado actual como último estado conocido, sin despachar el cambio
+    for (int key = 0; key < APP_KEYS; key++) {
+        DigitalInputWasChanged(inputs[key]);
+    }
+}
+
+void ApplyPowerLevel(void) {
+    powerLevels level = PowerGetLevel(power);
+
+    TraceRecord(TRACE_POWER, level);
+    // Sin actividad del usuario el brillo se limita según el nivel de consumo
+    if (level >= POWER_BLANK) {
+        AppLimitBrightness(app, 0);
     } else {
-        if (*tens > 0) {
-            (*tens)--;
-            // Establecer unidades al máximo permitido para la nueva decena
-            *units = GetMaxUnits(*tens, max_tens, max_units);
-        } else {
-            // Ir al valor máximo permitido
-            *tens = max_tens;
-            *units = GetMaxUnits(*tens, max_tens, max_units);
-        }
+        AppLimitBrightness(app, level == POWER_DIMMED ? POWER_DIM_BRIGHTNESS : SCREEN_BRIGHTNESS_MAX);
     }
+    DisplayScanEnable(level < POWER_BLANK);
+    SysTickSetPeriod(level == POWER_SLOW ? POWER_SLOW_TICKS : 1);
+}
+
+bool Hibernate(void) {
+    clockStateT state;
+
+    // La configuración pendiente se escribe antes, el apagado profundo reinicia el chip
+    StorageFlush(board->storage);
+    return ClockGetState(clock, &state) && HibernateEnter(board->hibernate, &state, AppGetMode(app));
+}
+
+bool WakeFromHibernation(void) {
+    clockStateT state;
+    uint8_t saved;
+
+    // Solo se hiberna mostrando la hora, cualquier otro modo indica un estado que no corresponde
+    return HibernateRestore(board->hibernate, &state, &saved) && saved == APP_SHOW_TIME && ClockSetState(clock, &state);
 }
 
 /* === Public function implementation ========================================================= */
 
 int main(void) {
-    clockTimeT hour;
-    clockTimeT alarm;
-
+    static const struct appDriverS appDriver = {
+        .RingingLed = RingingLed,
+        .AlarmLed = AlarmLed,
+        .Sound = AlarmSound,
+        .Notify = NotifyEvent,
+        .Save = SaveState,
+    };
+    uint32_t lastSave = 0;
+    uint32_t lastCycles = 0;
+#if HIBERNATE_IDLE
+    uint32_t lastActivity = 0;
+#endif
+    digitalInputT * inputs;
+    bool replaying = false;
+    settingsT settings;
+    uint32_t start;
+    bool restored;
+    bool woke;
+
+    CYCLES_INIT();
+    start = CYCLES_NOW();
+    TraceInit(&mseg);
     clock = ClockCreate(1000, AlarmRinging);
     board = BoardCreate();
-
+    console = ConsoleCreate(board->serial, clock, ConsoleChanged);
+    sync = SyncCreate(board->reference, clock);
+    app = AppCreate(clock, board->screen, &appDriver);
+    keys[APP_KEY_SET_TIME] = board->setTime;
+    keys[APP_KEY_SET_ALARM] = board->setAlarm;
+    keys[APP_KEY_DECREMENT] = board->decrement;
+    keys[APP_KEY_INCREMENT] = board->increment;
+    keys[APP_KEY_ACCEPT] = board->accept;
+    keys[APP_KEY_CANCEL] = board->cancel;
+    for (int key = 0; key < APP_KEYS; key++) {
+        replayInputs[key] = DigitalInputCreateWord(&replayKeys, key, false);
+    }
+    keylog = KeylogCreate(KEYLOG_ENTRIES);
+
+    // La configuración se lee siempre, al despertar aporta la zona horaria y la posición del log para los próximos
+    // guardados. La hora y la alarma se restauran antes de iniciar el SysTick
+    restored = RestoreSettings(&settings);
+    woke = WakeFromHibernation();
+    if (!woke && restored) {
+        // Sin una referencia que funcionara durante el corte la hora guardada no es confiable y se pide confirmarla
+        ClockRestoreSettings(clock, &settings.clock);
+    }
+    AppStart(app);
     SysTickInit(1000);
-    ChangeMode(UNCONFIGURED);
+    DisplayScanInit(DISPLAY_FRAME_RATE, DISPLAY_ON_TIME);
+    power = PowerCreate(POWER_TIMEOUTS, mseg);
+    ConsoleSetPower(console, power);
+    ConsoleSetSync(console, sync);
+    ConsoleSetKeylog(console, keylog);
+    if (woke) {
+        TraceRecord(TRACE_WAKE, Saturate((CYCLES_NOW() - start) / (SystemCoreClock / 1000000)));
+    }
 
     while (true) {
 
-        if (DigitalInputWasDeactivated(board->accept)) {
-            if (mode == SHOW_TIME) {
-                if (ClockIsAlarmRinging(clock)) {
-                    ClockSnoozeAlarm(clock, 5); // Posponer alarma 5 minutos
-                }else if(!ClockIsAlarmEnabled(clock)){
-                    ClockAlarmAction(clock, ALARM_ENABLE);
-                }
-            } else if (mode == SET_CURRENT_MINUTES) {
-                ChangeMode(SET_CURRENT_HOURS);
-            } else if (mode == SET_CURRENT_HOURS) {
-                SetHourMinuteBCD(&hour, digits);
-                ClockSetTime(clock, &hour);
-                ChangeMode(SHOW_TIME);
-            } else if (mode == SET_ALARM_MINUTES) {
-                ChangeMode(SET_ALARM_HOURS);
-            } else if (mode == SET_ALARM_HOURS) {
-                SetHourMinuteBCD(&alarm, digits);
-                ClockSetAlarm(clock, &alarm);
-                ChangeMode(SHOW_TIME);
+        // Mientras se reproduce el registro de teclas se leen las teclas reproducidas en lugar de las de la placa
+        if (KeylogReplayPoll(keylog, mseg, &replayKeys) != replaying) {
+            // Al cambiar de fuente se descartan las teclas que quedaron presionadas y los cambios ocurridos mientras
+            // no se leía cada fuente, para no despachar flancos viejos
+            replaying = !replaying;
+            if (!replaying) {
+                replayKeys = 0;
             }
+            KeysResync(keys);
+            KeysResync(replayInputs);
         }
-
-        if (DigitalInputWasDeactivated(board->cancel)) {
-            if (mode == SHOW_TIME) {
-                if (ClockIsAlarmRinging(clock)) {
-                    ClockAlarmAction(clock, ALARM_CANCEL);
-                } else if (ClockIsAlarmEnabled(clock)) {
-                    ClockAlarmAction(clock, ALARM_DISABLE);
-                }
-            } else if (mode == SET_CURRENT_MINUTES || mode == SET_CURRENT_HOURS) {
-                if (ClockGetTime(clock, &hour)) {
-                    ChangeMode(SHOW_TIME);
-                } else {
-                    ChangeMode(UNCONFIGURED); // Si la hora no es válida, volver a UNCONFIGURED
-                }
-            } else if (mode == SET_ALARM_MINUTES || mode == SET_ALARM_HOURS) {
-                ChangeMode(SHOW_TIME); // Cancelar configuración de alarma
+        inputs = replaying ? replayInputs : keys;
+        for (int key = 0; key < APP_KEYS; key++) {
+            if (DigitalInputWasDeactivated(inputs[key])) {
+                AppKey(app, key);
             }
         }
+        KeylogCapture(keylog, KeysPressed(keys), mseg);
 
-        if (DigitalInputWasDeactivated(board->setTime)) {
-            ChangeMode(SET_CURRENT_MINUTES);
-            ClockGetTime(clock, &hour);
-            GetHourMinuteBCD(&hour, digits);
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
+        if (AppGetMode(app) != APP_UNCONFIGURED && mseg - lastSave >= SAVE_TIME_PERIOD) {
+            lastSave = mseg;
+            SaveSettings(); // Guarda la hora periódicamente para perder poco tiempo ante un reinicio
         }
-
-        if (DigitalInputWasDeactivated(board->setAlarm)) {
-            dotsOn = false;
-            ChangeMode(SET_ALARM_MINUTES);
-            ClockGetAlarm(clock, &alarm);
-            GetHourMinuteBCD(&alarm, digits);
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
+        if (mseg - lastCycles >= CYCLES_PERIOD) {
+            lastCycles = mseg;
+            TraceCycles();
         }
-
-        if (DigitalInputWasDeactivated(board->decrement)) {
-            if (mode == SET_CURRENT_MINUTES || mode == SET_ALARM_MINUTES) {
-                BcdDecrement(&digits[3], &digits[2], 9, 5);
-            } else if (mode == SET_CURRENT_HOURS || mode == SET_ALARM_HOURS) {
-                BcdDecrement(&digits[1], &digits[0], 3, 2);
-            }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-            
-            if ((mode == SET_ALARM_MINUTES || mode == SET_ALARM_HOURS) && dotsOn) {
-                TOGGLE_DOT();
-                dotsOn = true;
+        // Las teclas y la alarma devuelven inmediatamente el funcionamiento normal
+        if (KeysPressed(inputs) || AppGetMode(app) != APP_SHOW_TIME || ClockIsAlarmRinging(clock)) {
+            if (PowerActivity(power, mseg)) {
+                ApplyPowerLevel();
             }
-
-            
+        } else if (PowerPoll(power, mseg)) {
+            ApplyPowerLevel();
         }
+#if HIBERNATE_IDLE
+        if (KeysPressed(inputs) || AppGetMode(app) != APP_SHOW_TIME || ClockIsAlarmRinging(clock)) {
+            lastActivity = mseg;
+        } else if (mseg - lastActivity >= HIBERNATE_IDLE) {
+            lastActivity = mseg;
+            Hibernate(); // Solo retorna si la alarma está por sonar o pospuesta, se vuelve a intentar luego
+        }
+#endif
+        StoragePoll(board->storage, mseg);
+        ConsolePoll(console);
 
-        if (DigitalInputWasDeactivated(board->increment)) {
-            if (mode == SET_CURRENT_MINUTES || mode == SET_ALARM_MINUTES) {
-                BcdIncrement(&digits[3], &digits[2], 9, 5);
-            } else if (mode == SET_CURRENT_HOURS || mode == SET_ALARM_HOURS) {
-                BcdIncrement(&digits[1], &digits[0], 3, 2);
-            }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-
-            if ((mode == SET_ALARM_MINUTES || mode == SET_ALARM_HOURS) && dotsOn) {
-                TOGGLE_DOT();
-                dotsOn = true; // nos aseguramos que sigue en true
-            }
+        if (SyncPoll(sync)) {
+            AppTimeSynced(app);
         }
 
-        for (int delay = 0; delay < 25000; delay++) {
-            __asm("NOP");
+        if (PowerGetLevel(power) == POWER_SLOW) {
+            BoardSleep();
+        } else {
+            BoardIdle();
         }
     }
 }
 
-void SysTick_Handler(void) {
-    static uint16_t count = 0;
-    clockTimeT hour;
-
-    ScreenRefresh(board->screen);
-    if (ClockGetTime(clock,&hour)){
-        ClockNewTick(clock);
-    }
+HOT_PATH void SysTick_Handler(void) {
+    uint32_t start = CYCLES_NOW();
+    uint8_t elapsed;
 
+    STACK_ISR_ENTER();
+    // Con el tick lento cada interrupción cubre varios milisegundos, el reloj avanza todos los ticks
+    elapsed = SysTickElapsed();
+    mseg += elapsed;
+    AppTick(app, elapsed);
+    DisplayScanPublish();
 
-    count = (count + 1) % 1000;
-    if (mode <= SHOW_TIME) {
-        ClockGetTime(clock, &hour);
-        GetHourMinuteBCD(&hour, digits);
-        ScreenWriteBCD(board->screen, digits, sizeof(digits));
-        if (count > 500 && mode == SHOW_TIME) {
-            ScreenToggleDot(board->screen, 1);
-        }
-        if (ClockIsAlarmActive(clock) && ClockIsAlarmEnabled(clock)) {
-            ScreenToggleDot(board->screen, 3);
-        }
-        if (!ClockIsAlarmRinging(clock)) {
-            DigitalOutputDesactivate(board->ledRed);
-        }
-        mseg++;
+    start = CYCLES_NOW() - start;
+    if (start > tickMaxCycles) {
+        tickMaxCycles = start;
     }
+    STACK_ISR_EXIT();
 }
 
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,133 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file power.c
+ ** @brief Implementación de la política de consumo según la actividad del usuario
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "power.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+struct powerS {
+    uint32_t timeouts[POWER_LEVELS]; //!< Tiempo sin actividad para pasar a cada nivel, cero si está deshabilitado
+    uint32_t activity;               //!< Instante de la última actividad
+    uint32_t updated;                //!< Instante hasta el que se acumuló la permanencia
+    powerLevels level;               //!< Nivel actual
+    powerStatsT stats;               //!< Permanencia acumulada en cada nivel
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Acumula en el nivel actual el tiempo transcurrido desde la actualización anterior y cambia de nivel.
+ *
+ * @param self  Puntero a la instancia de la política.
+ * @param level  Nuevo nivel.
+ * @param now  Instante actual.
+ * @return true Si el nivel cambió.
+ */
+static bool ChangeLevel(powerT self, powerLevels level, uint32_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool ChangeLevel(powerT self, powerLevels level, uint32_t now) {
+    self->stats.residency[self->level] += now - self->updated;
+    self->updated = now;
+    if (level == self->level) {
+        return false;
+    }
+    self->stats.transitions++;
+    self->level = level;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+powerT PowerCreate(const uint32_t timeouts[POWER_LEVELS], uint32_t now) {
+    powerT self = NULL;
+
+    if (timeouts) {
+        self = malloc(sizeof(struct powerS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct powerS));
+        memcpy(self->timeouts, timeouts, sizeof(self->timeouts));
+        self->activity = now;
+        self->updated = now;
+        self->level = POWER_FULL;
+    }
+    return self;
+}
+
+bool PowerActivity(powerT self, uint32_t now) {
+    if (!self) {
+        return false;
+    }
+    self->activity = now;
+    return ChangeLevel(self, POWER_FULL, now);
+}
+
+bool PowerPoll(powerT self, uint32_t now) {
+    powerLevels level = POWER_FULL;
+    uint32_t idle, longest = 0;
+
+    if (!self) {
+        return false;
+    }
+    // Se elige el nivel de menor consumo cuyo tiempo ya se cumplió, uno deshabilitado no corta la secuencia
+    idle = now - self->activity;
+    for (uint8_t index = POWER_FULL + 1; index < POWER_LEVELS; index++) {
+        if (self->timeouts[index] && idle >= self->timeouts[index]) {
+            level = index;
+        }
+        longest = (self->timeouts[index] > longest) ? self->timeouts[index] : longest;
+    }
+    if (idle > longest) {
+        // Cumplidos todos los tiempos se limita el tiempo sin actividad para que no desborde después de meses
+        self->activity = now - longest;
+    }
+    return ChangeLevel(self, level, now);
+}
+
+powerLevels PowerGetLevel(powerT self) {
+    return self ? self->level : POWER_FULL;
+}
+
+bool PowerGetStats(powerT self, powerStatsT * stats) {
+    if (!self || !stats) {
+        return false;
+    }
+    *stats = self->stats;
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
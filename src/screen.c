@@ -25,57 +25,108 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "screen.h"
+#include "hotpath.h"
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
 
+#ifdef SCREEN_STATIC_DRIVER
+#include SCREEN_STATIC_DRIVER
+#endif
+
 /* === Macros definitions ========================================================================================== */
 
-#ifndef SCREEN_MAX_DIGITS
-#define SCREEN_MAX_DIGITS 8
+#ifdef SCREEN_STATIC_DRIVER
+// El driver se resuelve al compilar, el puntero recibido en ScreenCreate no se usa
+#define DRIVER_DIGITS_TURN_OFF(self)          ScreenDriverDigitsTurnOff()
+#define DRIVER_SEGMENTS_UPDATES(self, value)  ScreenDriverSegmentsUpdates(value)
+#define DRIVER_DIGIT_TURN_ON(self, digit)     ScreenDriverDigitTurnOn(digit)
+#define DRIVER_FLUSH(self)                    ScreenDriverFlush()
+#else
+#define DRIVER_DIGITS_TURN_OFF(self)          (self)->driver->DigitsTurnOff()
+#define DRIVER_SEGMENTS_UPDATES(self, value)  (self)->driver->SegmentsUpdates(value)
+#define DRIVER_DIGIT_TURN_ON(self, digit)     (self)->driver->DigitTurnOn(digit)
+#define DRIVER_FLUSH(self)                                                                                             \
+    do {                                                                                                               \
+        if ((self)->driver->Flush) {                                                                                   \
+            (self)->driver->Flush();                                                                                   \
+        }                                                                                                              \
+    } while (0)
 #endif
 
+#define GLYPH_0 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_1 (SEGMENT_B | SEGMENT_C)
+#define GLYPH_2 (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_3 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define GLYPH_4 (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define GLYPH_5 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_6 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_7 (SEGMENT_A | SEGMENT_B | SEGMENT_C)
+#define GLYPH_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_9 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+
+//! Segmentos de un par de dígitos, las decenas en el byte bajo para que queden a la izquierda en el cuadro
+#define PAIR(tens, units) ((uint16_t)(GLYPH_##tens | GLYPH_##units << 8))
+
+//! Fila de la tabla de pares con las decenas indicadas, las seis posiciones que no son BCD válido quedan en blanco
+#define PAIR_ROW(tens)                                                                                                 \
+    PAIR(tens, 0), PAIR(tens, 1), PAIR(tens, 2), PAIR(tens, 3), PAIR(tens, 4), PAIR(tens, 5), PAIR(tens, 6),          \
+        PAIR(tens, 7), PAIR(tens, 8), PAIR(tens, 9), 0, 0, 0, 0, 0, 0
+
 /* === Private data type declarations ============================================================================== */
 
 struct screenS {
     uint8_t digits;
     uint8_t value[SCREEN_MAX_DIGITS];
     struct {
-        uint8_t from;
-        uint8_t to;
-        uint8_t count;
-        uint16_t frequency;
-    } flashing[1];
+        uint16_t digits;   //!< Dígitos de la región, un bit por dígito
+        uint8_t segments;  //!< Segmentos que se apagan en la fase apagada
+        uint16_t period;   //!< Cuadros de un ciclo completo, cero si la región no parpadea
+        uint16_t count;    //!< Cuadros transcurridos del ciclo actual
+    } flashing[SCREEN_FLASH_REGIONS];
+    uint8_t dots[SCREEN_MAX_DIGITS];         //!< Puntos fijos que se superponen a la imagen de cada dígito
+    uint8_t mask[SCREEN_MAX_DIGITS];         //!< Segmentos visibles de cada dígito en la fase actual del parpadeo
     screenDriverT driver;
     uint8_t currentDigit;
+    uint8_t currentBit;                      //!< Intervalo del turno del dígito actual
+    uint8_t segments;                        //!< Segmentos del dígito actual, calculados al comenzar su turno
+    bool lit;                                //!< Indica si el dígito actual está encendido
+    uint8_t brightness[SCREEN_MAX_DIGITS];   //!< Nivel de brillo de cada dígito
+    uint16_t frameRate;                      //!< Cuadros por segundo del barrido
 };
 
-static const uint8_t IMAGES[10] = {
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
-    SEGMENT_B | SEGMENT_C,                                                             // 1
-    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         // 3
-    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     // 4
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // 5
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // 6
-    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G              // 9
+//! Segmentos de cada dígito, los valores que no son BCD válido se muestran en blanco
+static const uint8_t IMAGES[16] HOT_DATA = {
+    GLYPH_0, GLYPH_1, GLYPH_2, GLYPH_3, GLYPH_4, GLYPH_5, GLYPH_6, GLYPH_7, GLYPH_8, GLYPH_9,
+};
+
+/**
+ * Segmentos de los 100 pares de dígitos, indexados directamente por el byte BCD empaquetado. Cualquier byte es un
+ * índice válido: los que no son BCD válido, incluidas las filas de decenas 10 a 15 que se omiten, quedan en blanco.
+ */
+static const uint16_t PAIRS[256] HOT_DATA = {
+    PAIR_ROW(0), PAIR_ROW(1), PAIR_ROW(2), PAIR_ROW(3), PAIR_ROW(4),
+    PAIR_ROW(5), PAIR_ROW(6), PAIR_ROW(7), PAIR_ROW(8), PAIR_ROW(9),
 };
 
 /* === Private function declarations =============================================================================== */
 
 /**
- * @brief Controla el parpadeo del display.
+ * @brief Recalcula la máscara de segmentos visibles de cada dígito según la fase de cada región de parpadeo.
  *
  * @param self Puntero a la instancia de la pantalla.
+ */
+static void UpdateMask(screenT self);
+
+/**
+ * @brief Avanza un cuadro el parpadeo de todas las regiones.
  *
- * @return El valor de los segmentos a mostrar en el dígito actual.
+ * @param self Puntero a la instancia de la pantalla.
  *
- * @note Si la frecuencia de parpadeo es 0, no se realiza el parpadeo y se devuelve el valor del dígito actual.
+ * @note La máscara solo se recalcula cuando alguna región cambia de fase, el resto de los cuadros no tiene costo.
  */
-static uint8_t Flashing(screenT self);
+static void Flashing(screenT self);
 
 /* === Private variable definitions ================================================================================ */
 
@@ -83,21 +134,36 @@ static uint8_t Flashing(screenT self);
 
 /* === Private function definitions ================================================================================ */
 
-static uint8_t Flashing(screenT self) {
-    uint8_t result = self->value[self->currentDigit];
-    if (self->flashing->frequency != 0) {
-        if (self->currentDigit == 0) {
-            self->flashing->count = (self->flashing->count + 1) % self->flashing->frequency;
-        }
-        if (self->flashing->count < (self->flashing->frequency / 2)) {
-            if (self->currentDigit >= self->flashing->from) {
-                if (self->currentDigit <= self->flashing->to) {
-                    result = 0;
+HOT_PATH static void UpdateMask(screenT self) {
+    memset(self->mask, 0xFF, sizeof(self->mask));
+    for (uint8_t region = 0; region < SCREEN_FLASH_REGIONS; region++) {
+        if (self->flashing[region].count < self->flashing[region].period / 2) {
+            for (uint8_t digit = 0; digit < self->digits; digit++) {
+                if (self->flashing[region].digits & (1 << digit)) {
+                    self->mask[digit] &= ~self->flashing[region].segments;
                 }
             }
         }
     }
-    return result;
+}
+
+HOT_PATH static void Flashing(screenT self) {
+    bool changed = false;
+
+    for (uint8_t region = 0; region < SCREEN_FLASH_REGIONS; region++) {
+        if (self->flashing[region].period != 0) {
+            self->flashing[region].count++;
+            if (self->flashing[region].count >= self->flashing[region].period) {
+                self->flashing[region].count = 0;
+                changed = true;
+            } else if (self->flashing[region].count == self->flashing[region].period / 2) {
+                changed = true;
+            }
+        }
+    }
+    if (changed) {
+        UpdateMask(self);
+    }
 }
 
 /* === Public function implementation ============================================================================== */
@@ -111,52 +177,174 @@ screenT ScreenCreate(uint8_t digits, screenDriverT driver) {
         self->digits = digits;
         self->driver = driver;
         self->currentDigit = 0;
-        self->flashing->count = 0;
-        self->flashing->frequency = 0;
+        self->currentBit = SCREEN_BRIGHTNESS_BITS - 1;
+        self->lit = false;
+        memset(self->brightness, SCREEN_BRIGHTNESS_MAX, sizeof(self->brightness));
+        memset(self->flashing, 0, sizeof(self->flashing));
+        memset(self->dots, 0, sizeof(self->dots));
+        memset(self->mask, 0xFF, sizeof(self->mask));
+        self->frameRate = SCREEN_FRAME_RATE;
     }
     return self;
 }
 
 void ScreenWriteBCD(screenT self, uint8_t * value, uint8_t size) {
-    memset(self->value, 0, sizeof(self->value)); // establece todos los elementos a 0
+    uint8_t images[SCREEN_MAX_DIGITS] = {0};
+
     if (size > self->digits) {
         size = self->digits;
     }
     for (uint8_t i = 0; i < size; i++) {
-        self->value[i] = IMAGES[value[i]];
+        images[i] = IMAGES[value[i] & 0x0F];
+    }
+    // El refresco puede interrumpir la escritura, se copia la imagen completa para no mostrar dígitos en blanco
+    memcpy(self->value, images, sizeof(self->value));
+}
+
+HOT_PATH uint32_t ScreenRenderBCD(uint16_t value) {
+    return PAIRS[value >> 8] | (uint32_t)PAIRS[value & 0xFF] << 16;
+}
+
+HOT_PATH void ScreenWriteFrame(screenT self, uint32_t frame) {
+    uint8_t images[SCREEN_MAX_DIGITS] = {0};
+
+    for (uint8_t i = 0; i < 4 && i < self->digits; i++) {
+        images[i] = frame >> (8 * i);
+    }
+    memcpy(self->value, images, sizeof(self->value));
+}
+
+HOT_PATH uint8_t ScreenRefresh(screenT self) {
+    uint8_t digit;
+    bool lit;
+
+    self->currentBit++;
+    if (self->currentBit >= SCREEN_BRIGHTNESS_BITS) {
+        self->currentBit = 0;
+        DRIVER_DIGITS_TURN_OFF(self);
+        self->lit = false;
+        self->currentDigit++;
+        if (self->currentDigit >= self->digits) {
+            self->currentDigit = 0;
+            Flashing(self);
+        }
+        digit = self->currentDigit;
+        self->segments = (self->value[digit] | self->dots[digit]) & self->mask[digit];
     }
+
+    // Solo se accede al hardware cuando el dígito cambia de estado entre intervalos
+    lit = (self->brightness[self->currentDigit] >> self->currentBit) & 1;
+    if (lit && !self->lit) {
+        DRIVER_SEGMENTS_UPDATES(self, self->segments);
+        DRIVER_DIGIT_TURN_ON(self, self->currentDigit);
+    } else if (!lit && self->lit) {
+        DRIVER_DIGITS_TURN_OFF(self);
+    }
+    self->lit = lit;
+    DRIVER_FLUSH(self);
+
+    return 1 << self->currentBit;
 }
 
-void ScreenRefresh(screenT self) {
-    uint8_t segments;
+void ScreenSetBrightness(screenT self, uint8_t level) {
+    if (!self) {
+        return; // Protección ante NULL
+    }
+    if (level > SCREEN_BRIGHTNESS_MAX) {
+        level = SCREEN_BRIGHTNESS_MAX;
+    }
+    memset(self->brightness, level, sizeof(self->brightness));
+}
 
-    self->driver->DigitsTurnOff();
-    self->currentDigit = (self->currentDigit + 1) % self->digits;
+bool ScreenSetDigitBrightness(screenT self, uint8_t digit, uint8_t level) {
+    if (!self || digit >= self->digits) {
+        return false;
+    }
+    self->brightness[digit] = (level > SCREEN_BRIGHTNESS_MAX) ? SCREEN_BRIGHTNESS_MAX : level;
+    return true;
+}
 
-    segments = Flashing(self);
+HOT_PATH void ScreenBlank(screenT self) {
+    DRIVER_DIGITS_TURN_OFF(self);
+    self->lit = false;
+    DRIVER_FLUSH(self);
+}
 
-    self->driver->SegmentsUpdates(segments);
-    self->driver->DigitTurnOn(self->currentDigit);
+void ScreenSetFrameRate(screenT self, uint16_t rate) {
+    if (self && rate) {
+        // Los parpadeos en curso se reescalan para conservar su duración
+        for (uint8_t region = 0; region < SCREEN_FLASH_REGIONS; region++) {
+            self->flashing[region].period = (uint32_t)self->flashing[region].period * rate / self->frameRate;
+            self->flashing[region].count = 0;
+        }
+        self->frameRate = rate;
+        UpdateMask(self);
+    }
 }
 
-int ScreenFlashDigits(screenT self, uint8_t from, uint8_t to, uint16_t divisor) {
+int ScreenFlashRegion(screenT self, uint8_t region, uint8_t from, uint8_t to, uint8_t segments, uint16_t divisor) {
     int result = 0;
-    if (from > to || from >= SCREEN_MAX_DIGITS || to >= SCREEN_MAX_DIGITS) {
+    if (from > to || from >= SCREEN_MAX_DIGITS || to >= SCREEN_MAX_DIGITS || region >= SCREEN_FLASH_REGIONS) {
         result = -1; // Error: from debe ser menor o igual a to
     } else if (!self) {
         result = -1; // Error: pantalla no inicializada
     } else {
-        self->flashing->from = from;
-        self->flashing->to = to;
-        self->flashing->frequency = 2 * divisor;
-        self->flashing->count = 0;
+        self->flashing[region].digits = ((1UL << (to + 1)) - 1) & ~((1UL << from) - 1);
+        self->flashing[region].segments = segments;
+        self->flashing[region].period = (uint32_t)2 * divisor * self->frameRate / SCREEN_FRAME_RATE;
+        self->flashing[region].count = 0;
+        UpdateMask(self);
     }
 
     return result;
 }
 
-void ScreenToggleDot(screenT self, uint8_t position) {
-    self->value[position] ^= SEGMENT_DP;
+int ScreenFlashDigits(screenT self, uint8_t from, uint8_t to, uint16_t divisor) {
+    return ScreenFlashRegion(self, 0, from, to, SCREEN_FLASH_ALL, divisor);
+}
+
+void ScreenSetDots(screenT self, uint16_t digits) {
+    if (!self) {
+        return; // Protección ante NULL
+    }
+    for (uint8_t digit = 0; digit < SCREEN_MAX_DIGITS; digit++) {
+        self->dots[digit] = (digits & (1 << digit)) ? SEGMENT_DP : 0;
+    }
+}
+
+void ScreenGetState(screenT self, screenStateT * state) {
+    if (!self || !state) {
+        return; // Protección ante NULL
+    }
+    memset(state, 0, sizeof(screenStateT));
+    memcpy(state->value, self->value, sizeof(state->value));
+    memcpy(state->dots, self->dots, sizeof(state->dots));
+    memcpy(state->brightness, self->brightness, sizeof(state->brightness));
+    for (uint8_t region = 0; region < SCREEN_FLASH_REGIONS; region++) {
+        state->flashing[region].digits = self->flashing[region].digits;
+        state->flashing[region].period = self->flashing[region].period;
+        state->flashing[region].segments = self->flashing[region].segments;
+    }
+}
+
+void ScreenSetState(screenT self, const screenStateT * state) {
+    if (!self || !state) {
+        return; // Protección ante NULL
+    }
+    memcpy(self->value, state->value, sizeof(self->value));
+    memcpy(self->dots, state->dots, sizeof(self->dots));
+    memcpy(self->brightness, state->brightness, sizeof(self->brightness));
+    for (uint8_t region = 0; region < SCREEN_FLASH_REGIONS; region++) {
+        if (self->flashing[region].digits != state->flashing[region].digits ||
+            self->flashing[region].period != state->flashing[region].period ||
+            self->flashing[region].segments != state->flashing[region].segments) {
+            self->flashing[region].digits = state->flashing[region].digits;
+            self->flashing[region].period = state->flashing[region].period;
+            self->flashing[region].segments = state->flashing[region].segments;
+            self->flashing[region].count = 0;
+        }
+    }
+    UpdateMask(self);
 }
 
 /* === End of documentation ======================================================================================== */
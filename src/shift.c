@@ -0,0 +1,123 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file shift.c
+ ** @brief Implementación del driver de pantalla con registros de desplazamiento del tipo 74HC595
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "shift.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SHIFT_MAX_SIZE SHIFT_FRAME_SIZE(SCREEN_MAX_DIGITS) //!< Tamaño de la trama más larga
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado del driver, copia de las salidas de la cadena de registros
+struct shiftS {
+    shiftSendT send;                //!< Función que transmite la trama
+    uint8_t size;                   //!< Cantidad de registros de la cadena
+    uint8_t frame[SHIFT_MAX_SIZE];  //!< Trama a transmitir, los segmentos van en el último byte
+    uint8_t sent[SHIFT_MAX_SIZE];   //!< Última trama transmitida
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Apaga todos los dígitos y los segmentos en la copia local.
+ */
+static void ShiftDigitsTurnOff(void);
+
+/**
+ * @brief Actualiza los segmentos en la copia local.
+ *
+ * @param value Segmentos a encender.
+ */
+static void ShiftSegmentsUpdates(uint8_t value);
+
+/**
+ * @brief Enciende un dígito en la copia local.
+ *
+ * @param digit Posición del dígito.
+ */
+static void ShiftDigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Transmite la copia local si cambió desde la última trama enviada.
+ */
+static void ShiftFlush(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct shiftS shift;
+
+static const struct screenDriverS shiftDriver = {
+    .DigitsTurnOff = ShiftDigitsTurnOff,
+    .SegmentsUpdates = ShiftSegmentsUpdates,
+    .DigitTurnOn = ShiftDigitTurnOn,
+    .Flush = ShiftFlush,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ShiftDigitsTurnOff(void) {
+    memset(shift.frame, 0, shift.size);
+}
+
+static void ShiftSegmentsUpdates(uint8_t value) {
+    shift.frame[shift.size - 1] = value;
+}
+
+static void ShiftDigitTurnOn(uint8_t digit) {
+    // El byte de los primeros ocho dígitos es el anterior a los segmentos, los siguientes se alejan en la cadena
+    shift.frame[shift.size - 2 - digit / 8] |= 1 << (digit % 8);
+}
+
+static void ShiftFlush(void) {
+    if (memcmp(shift.frame, shift.sent, shift.size) != 0) {
+        memcpy(shift.sent, shift.frame, shift.size);
+        shift.send(shift.sent, shift.size);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+screenDriverT ShiftScreenCreate(uint8_t digits, shiftSendT send) {
+    if (!send || digits == 0 || digits > SCREEN_MAX_DIGITS) {
+        return NULL;
+    }
+    shift.send = send;
+    shift.size = SHIFT_FRAME_SIZE(digits);
+    memset(shift.frame, 0, sizeof(shift.frame));
+
+    // La primera trama apaga la pantalla, el contenido de los registros al arrancar es indeterminado
+    memset(shift.sent, 0xFF, sizeof(shift.sent));
+    ShiftFlush();
+    return &shiftDriver;
+}
+
+/* === End of documentation ======================================================================================== */
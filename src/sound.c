@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file sound.c
+ ** @brief Implementación del secuenciador de melodías para el zumbador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "sound.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SOUND_TOP_OCTAVE 10 //!< Octava de la tabla de frecuencias, las notas MIDI 120 a 131
+
+/* === Private data type declarations ============================================================================== */
+
+struct soundS {
+    soundDriverT driver;
+    const soundPatternT * patterns; //!< Secuencia en reproducción
+    uint8_t count;                  //!< Cantidad de patrones de la secuencia
+    uint8_t level;                  //!< Patrón en reproducción
+    uint8_t note;                   //!< Nota en reproducción dentro del patrón
+    uint8_t repeat;                 //!< Repeticiones completas del patrón actual
+    volatile bool playing;
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Genera la nota actual y programa el temporizador para cuando termine.
+ *
+ * @param self  Referencia al secuenciador.
+ */
+static void SoundEmit(soundT self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Frecuencias de la octava más alta, las demás se obtienen dividiendo por potencias de dos
+static const uint16_t TOP_OCTAVE[12] = {8372, 8870, 9397, 9956, 10548, 11175, 11840, 12544, 13290, 14080, 14917, 15804};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SoundEmit(soundT self) {
+    const soundNoteT * note = &self->patterns[self->level].notes[self->note];
+    uint8_t duration = note->duration ? note->duration : 1;
+
+    self->driver->Tone(SoundFrequency(note->note));
+    self->driver->Schedule(duration * SOUND_TICK);
+}
+
+/* === Public function implementation ============================================================================== */
+
+soundT SoundCreate(soundDriverT driver) {
+    soundT self = NULL;
+
+    if (driver && driver->Tone && driver->Schedule) {
+        self = malloc(sizeof(struct soundS));
+    }
+    if (self) {
+        self->driver = driver;
+        self->playing = false;
+    }
+    return self;
+}
+
+bool SoundPlay(soundT self, const soundPatternT * patterns, uint8_t count) {
+    if (!self || !patterns || count == 0) {
+        return false;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if (!patterns[index].notes || patterns[index].count == 0) {
+            return false;
+        }
+    }
+
+    // Se cancela el llamado pendiente antes de cambiar la secuencia que lee el temporizador
+    self->playing = false;
+    self->driver->Schedule(0);
+    self->patterns = patterns;
+    self->count = count;
+    self->level = 0;
+    self->note = 0;
+    self->repeat = 0;
+    self->playing = true;
+    SoundEmit(self);
+    return true;
+}
+
+void SoundStop(soundT self) {
+    if (self) {
+        self->playing = false;
+        self->driver->Schedule(0);
+        self->driver->Tone(0);
+    }
+}
+
+void SoundNext(soundT self) {
+    const soundPatternT * pattern;
+
+    if (!self || !self->playing) {
+        return;
+    }
+    pattern = &self->patterns[self->level];
+    self->note++;
+    if (self->note >= pattern->count) {
+        self->note = 0;
+        self->repeat++;
+        if (pattern->repeats && self->repeat >= pattern->repeats) {
+            self->repeat = 0;
+            self->level++;
+            if (self->level >= self->count) {
+                SoundStop(self);
+                return;
+            }
+        }
+    }
+    SoundEmit(self);
+}
+
+bool SoundIsPlaying(soundT self) {
+    return self ? self->playing : false;
+}
+
+uint8_t SoundGetLevel(soundT self) {
+    return self ? self->level : 0;
+}
+
+uint16_t SoundFrequency(uint8_t note) {
+    uint8_t shift;
+
+    if (note == SOUND_REST || note / 12 > SOUND_TOP_OCTAVE) {
+        return 0;
+    }
+    // Se redondea sumando la mitad del divisor antes de desplazar
+    shift = SOUND_TOP_OCTAVE - note / 12;
+    return (TOP_OCTAVE[note % 12] + ((1 << shift) >> 1)) >> shift;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file stack.c
+ ** @brief Implementación de la medición del uso máximo de la pila y la anidación de interrupciones
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "stack.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define STACK_PATTERN 0xDEADBEEF //!< Valor con el que se pinta la pila libre
+
+#ifndef STACK_MARGIN
+#define STACK_MARGIN 16 //!< Palabras por debajo del puntero de pila que no se pintan, las usa la propia función
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t * stackBottom = NULL;
+static uint32_t * stackTop = NULL;
+static volatile uint8_t depth = 0;      //!< Interrupciones anidadas en curso
+static volatile uint8_t maxDepth = 0;   //!< Máxima anidación registrada
+static volatile uint32_t preempted = 0; //!< Máxima profundidad del programa principal al ser interrumpido
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void StackMonitorInit(uint32_t * bottom, uint32_t * top) {
+    volatile uint32_t marker = 0;
+    uint32_t * limit = top;
+
+    if (!bottom || !top || bottom >= top) {
+        return;
+    }
+    // Si la pila actual está dentro de la región solo se pinta la parte que todavía no se usa
+    if ((uint32_t *)&marker > bottom && (uint32_t *)&marker < top) {
+        limit = (uint32_t *)&marker - STACK_MARGIN;
+    }
+    for (uint32_t * word = bottom; word < limit; word++) {
+        *word = STACK_PATTERN;
+    }
+    stackBottom = bottom;
+    stackTop = top;
+    depth = 0;
+    maxDepth = 0;
+    preempted = 0;
+}
+
+bool StackMonitorGet(stackStatsT * stats) {
+    uint32_t * word = stackBottom;
+
+    if (!stats || !stackBottom) {
+        return false;
+    }
+    // El patrón solo se conserva por debajo de la máxima profundidad alcanzada
+    while (word < stackTop && *word == STACK_PATTERN) {
+        word++;
+    }
+    stats->size = (uint32_t)(stackTop - stackBottom) * sizeof(uint32_t);
+    stats->used = (uint32_t)(stackTop - word) * sizeof(uint32_t);
+    stats->preempted = preempted;
+    stats->nesting = maxDepth;
+    return true;
+}
+
+void StackMonitorEnter(void * frame) {
+    uint32_t * pointer = frame;
+
+    // Una interrupción que anida restaura el contador antes de volver, no hace falta un acceso atómico
+    depth++;
+    if (depth > maxDepth) {
+        maxDepth = depth;
+    }
+    if (depth == 1 && pointer > stackBottom && pointer <= stackTop) {
+        uint32_t used = (uint32_t)(stackTop - pointer) * sizeof(uint32_t);
+        if (used > preempted) {
+            preempted = used;
+        }
+    }
+}
+
+void StackMonitorExit(void) {
+    if (depth) {
+        depth--;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
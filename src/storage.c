@@ -0,0 +1,193 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file storage.c
+ ** @brief Implementación de un log circular de registros con CRC para memorias no volátiles
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "storage.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define RECORD_MAGIC 0x5AC3 //!< Marca que identifica a un registro escrito
+
+#define CRC_INITIAL    0xFFFF //!< Valor inicial del CRC-16/CCITT
+#define CRC_POLYNOMIAL 0x1021 //!< Polinomio del CRC-16/CCITT
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro del log, con STORAGE_PAYLOAD_SIZE bytes de datos ocupa exactamente un slot de la memoria
+typedef struct storageRecordS {
+    uint16_t magic;                        //!< Marca de registro escrito
+    uint16_t size;                         //!< Cantidad de bytes válidos de datos
+    uint32_t sequence;                     //!< Número de secuencia, el mayor es el más reciente
+    uint8_t payload[STORAGE_PAYLOAD_SIZE]; //!< Datos guardados
+    uint16_t crc;                          //!< CRC de todos los campos anteriores
+} storageRecordT;
+
+struct storageS {
+    storageDriverT driver;  //!< Driver de la memoria no volátil
+    uint32_t slots;         //!< Cantidad de registros que entran en la memoria
+    uint32_t nextSlot;      //!< Posición donde se escribirá el próximo registro
+    uint32_t sequence;      //!< Número de secuencia del último registro escrito
+    uint32_t holdoff;       //!< Tiempo de espera sin cambios antes de escribir
+    uint32_t changedAt;     //!< Instante del último cambio pendiente
+    bool pending;           //!< Indica si hay datos pendientes de escribir
+    storageRecordT record;  //!< Registro con los datos pendientes de escribir
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el CRC-16/CCITT de un bloque de datos.
+ *
+ * @param data  Puntero a los datos.
+ * @param size  Cantidad de bytes.
+ * @return uint16_t CRC calculado.
+ */
+static uint16_t Crc16(const void * data, uint16_t size);
+
+/**
+ * @brief Escribe el registro pendiente en el próximo slot del log.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ */
+static void WriteRecord(storageT self);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t Crc16(const void * data, uint16_t size) {
+    const uint8_t * bytes = data;
+    uint16_t crc = CRC_INITIAL;
+
+    while (size--) {
+        crc ^= (uint16_t)(*bytes++) << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ CRC_POLYNOMIAL : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void WriteRecord(storageT self) {
+    self->sequence++;
+    self->record.magic = RECORD_MAGIC;
+    self->record.sequence = self->sequence;
+    self->record.crc = Crc16(&self->record, offsetof(storageRecordT, crc));
+
+    // Los registros se escriben en forma circular para repartir el desgaste sobre toda la memoria
+    self->driver->Write(self->nextSlot * STORAGE_SLOT_SIZE, &self->record, sizeof(storageRecordT));
+    self->nextSlot = (self->nextSlot + 1) % self->slots;
+    self->pending = false;
+}
+
+/* === Public function implementation ============================================================================== */
+
+storageT StorageCreate(storageDriverT driver, uint32_t holdoff) {
+    storageT self = NULL;
+
+    if (driver && driver->size >= STORAGE_SLOT_SIZE) {
+        self = malloc(sizeof(struct storageS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct storageS));
+        self->driver = driver;
+        self->slots = driver->size / STORAGE_SLOT_SIZE;
+        self->holdoff = holdoff;
+    }
+    return self;
+}
+
+bool StorageRestore(storageT self, void * data, uint16_t size) {
+    storageRecordT record;
+    bool found = false;
+    bool copied = false;
+
+    if (!self || !data || size > STORAGE_PAYLOAD_SIZE) {
+        return false;
+    }
+
+    for (uint32_t slot = 0; slot < self->slots; slot++) {
+        if (!self->driver->Read(slot * STORAGE_SLOT_SIZE, &record, sizeof(storageRecordT))) {
+            continue;
+        }
+        if (record.magic != RECORD_MAGIC || (found && record.sequence <= self->sequence)) {
+            continue; // Solo se verifica el CRC de los registros más recientes que el mejor encontrado
+        }
+        if (record.crc != Crc16(&record, offsetof(storageRecordT, crc))) {
+            continue; // Registro incompleto, por ejemplo por un corte de energía durante la escritura
+        }
+        found = true;
+        self->sequence = record.sequence;
+        self->nextSlot = (slot + 1) % self->slots;
+        copied = (record.size == size);
+        if (copied) {
+            memcpy(data, record.payload, size);
+        }
+    }
+    return copied;
+}
+
+bool StorageSave(storageT self, const void * data, uint16_t size, uint32_t now) {
+    if (!self || !data || size > STORAGE_PAYLOAD_SIZE) {
+        return false;
+    }
+
+    // Un nuevo cambio reemplaza al pendiente y reinicia la espera, así varios cambios seguidos son una sola escritura
+    memset(self->record.payload, 0, sizeof(self->record.payload));
+    memcpy(self->record.payload, data, size);
+    self->record.size = size;
+    self->changedAt = now;
+    self->pending = true;
+    return true;
+}
+
+bool StoragePoll(storageT self, uint32_t now) {
+    if (!self || !self->pending || (now - self->changedAt) < self->holdoff) {
+        return false;
+    }
+    if (self->driver->Busy && self->driver->Busy()) {
+        return false; // La escritura anterior todavía no terminó
+    }
+    WriteRecord(self);
+    return true;
+}
+
+void StorageFlush(storageT self) {
+    if (self && self->pending) {
+        while (self->driver->Busy && self->driver->Busy()) {
+        }
+        WriteRecord(self);
+        while (self->driver->Busy && self->driver->Busy()) {
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,324 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file sync.c
+ ** @brief Implementación de la sincronización del reloj con una referencia de tiempo externa
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "sync.h"
+#include "calendar.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SYNC_LINE_SIZE 83 //!< Longitud máxima de una sentencia NMEA, incluyendo el fin de línea
+#define SYNC_READ_SIZE 16 //!< Cantidad de bytes que se leen del medio de transporte en cada paso
+#define SYNC_FIELDS    13 //!< Cantidad máxima de campos que se interpretan de una sentencia
+
+#ifndef SYNC_SLEW_TIME
+#define SYNC_SLEW_TIME 16 //!< Segundos en los que se corrige el desfasaje medido
+#endif
+
+#ifndef SYNC_DRIFT_INTERVAL
+#define SYNC_DRIFT_INTERVAL 64 //!< Segundos mínimos entre estimaciones de la deriva
+#endif
+
+#define SYNC_DRIFT_GAIN 4 //!< Inversa de la ganancia del filtro que promedia las estimaciones de la deriva
+
+#define NANOSECONDS 1000000000LL //!< Nanosegundos en un segundo
+#define FRACTION    (1LL << 32)    //!< Unidad de la fracción de segundo del reloj
+
+/* === Private data type declarations ============================================================================== */
+
+struct syncS {
+    syncDriverT driver;         //!< Medio de transporte de las referencias
+    clockT clock;               //!< Reloj que se sincroniza
+    char line[SYNC_LINE_SIZE];  //!< Sentencia en recepción
+    uint8_t length;             //!< Cantidad de caracteres recibidos en la sentencia
+    bool synchronized;          //!< Indica si ya se aplicó una primera referencia
+    uint32_t lastUtc;           //!< Instante de la última referencia, en segundos UTC
+    uint32_t driftUtc;          //!< Instante de la referencia con la que comenzó la estimación de la deriva
+    int64_t driftOffset;        //!< Desfasaje al comenzar la estimación de la deriva, en nanosegundos
+    int64_t trimIntegral;       //!< Corrección aplicada desde que comenzó la estimación, en ppb por segundo
+    bool driftValid;            //!< Indica si ya se completó una estimación de la deriva
+    syncStatsT stats;           //!< Estadísticas de la sincronización
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Verifica la suma de verificación de la sentencia recibida y aplica la referencia que contiene.
+ *
+ * @param self  Puntero a la instancia de la sincronización.
+ * @return true Si se aplicó la referencia al reloj.
+ */
+static bool ProcessLine(syncT self);
+
+/**
+ * @brief Interpreta una hora con formato hhmmss y fracción de segundo opcional.
+ *
+ * @param text  Texto a interpretar.
+ * @param seconds  Puntero donde se almacenan los segundos desde las 00:00:00.
+ * @param fraction  Puntero donde se almacena la fracción de segundo, en unidades de 2^-32 segundos.
+ * @return true Si el texto tiene el formato esperado.
+ */
+static bool ParseTime(const char * text, uint32_t * seconds, uint32_t * fraction);
+
+/**
+ * @brief Interpreta un número decimal de cantidad de dígitos fija.
+ *
+ * @param text  Texto a interpretar.
+ * @param digits  Cantidad de dígitos.
+ * @param value  Puntero donde se almacena el valor.
+ * @return true Si los caracteres son todos dígitos.
+ */
+static bool ParseNumber(const char * text, uint8_t digits, uint32_t * value);
+
+/**
+ * @brief Compara la referencia con el reloj y corrige la hora o la frecuencia según el desfasaje.
+ *
+ * @param self  Puntero a la instancia de la sincronización.
+ * @param utc  Segundos UTC de la referencia.
+ * @param fraction  Fracción de segundo de la referencia, en unidades de 2^-32 segundos.
+ */
+static void ApplyReference(syncT self, uint32_t utc, uint32_t fraction);
+
+/**
+ * @brief Limita un valor a la corrección de frecuencia máxima.
+ *
+ * @param value  Valor en partes por billón.
+ * @return int32_t Valor limitado a ±SYNC_MAX_TRIM.
+ */
+static int32_t LimitTrim(int64_t value);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool ParseNumber(const char * text, uint8_t digits, uint32_t * value) {
+    *value = 0;
+    for (uint8_t index = 0; index < digits; index++) {
+        if (text[index] < '0' || text[index] > '9') {
+            return false;
+        }
+        *value = *value * 10 + (text[index] - '0');
+    }
+    return true;
+}
+
+static bool ParseTime(const char * text, uint32_t * seconds, uint32_t * fraction) {
+    uint32_t hours, minutes, value, scale = 1;
+
+    if (!ParseNumber(text, 2, &hours) || !ParseNumber(text + 2, 2, &minutes) || !ParseNumber(text + 4, 2, &value)) {
+        return false;
+    }
+    if (hours > 23 || minutes > 59 || value > 59) {
+        return false;
+    }
+    *seconds = hours * 3600 + minutes * 60 + value;
+
+    value = 0;
+    if (text[6] == '.') {
+        for (text += 7; *text >= '0' && *text <= '9' && scale < 1000000; text++) {
+            value = value * 10 + (*text - '0');
+            scale *= 10;
+        }
+    }
+    *fraction = (uint32_t)(((uint64_t)value << 32) / scale);
+    return true;
+}
+
+static int32_t LimitTrim(int64_t value) {
+    if (value > SYNC_MAX_TRIM) {
+        return SYNC_MAX_TRIM;
+    }
+    if (value < -SYNC_MAX_TRIM) {
+        return -SYNC_MAX_TRIM;
+    }
+    return (int32_t)value;
+}
+
+static bool ProcessLine(syncT self) {
+    char * fields[SYNC_FIELDS] = {0};
+    uint8_t count = 0, checksum = 0;
+    uint32_t received, seconds, fraction, day = 0, month = 0, year = 0;
+    calendarDateT date;
+    const char * type;
+    char * cursor;
+    bool valid;
+
+    self->line[self->length] = '\0';
+    cursor = strchr(self->line, '*');
+    if (self->line[0] != '$' || !cursor) {
+        self->stats.errors++;
+        return false;
+    }
+    for (char * text = self->line + 1; text < cursor; text++) {
+        checksum ^= (uint8_t)*text;
+    }
+    received = strtoul(cursor + 1, NULL, 16);
+    if (strlen(cursor + 1) != 2 || received != checksum) {
+        self->stats.errors++;
+        return false;
+    }
+
+    *cursor = '\0';
+    for (cursor = self->line; cursor && count < SYNC_FIELDS; count++) {
+        fields[count] = cursor;
+        cursor = strchr(cursor, ',');
+        if (cursor) {
+            *cursor++ = '\0';
+        }
+    }
+
+    // Se acepta cualquier emisor, solo se mira el tipo de sentencia
+    type = (strlen(fields[0]) == 6) ? fields[0] + 3 : "";
+    if (!strcmp(type, "RMC")) {
+        if (count > 2 && strcmp(fields[2], "A")) {
+            return false; // Sin posición válida el receptor todavía no tiene la hora
+        }
+        valid = count > 9 && strlen(fields[9]) == 6 && ParseNumber(fields[9], 2, &day) &&
+                ParseNumber(fields[9] + 2, 2, &month) && ParseNumber(fields[9] + 4, 2, &year);
+        year += 2000;
+    } else if (!strcmp(type, "ZDA")) {
+        valid = count > 4 && ParseNumber(fields[2], 2, &day) && ParseNumber(fields[3], 2, &month) &&
+                ParseNumber(fields[4], 4, &year);
+    } else {
+        return false; // Las demás sentencias no informan la fecha y se ignoran
+    }
+
+    date.year = year;
+    date.month = month;
+    date.day = day;
+    if (!valid || !ParseTime(fields[1], &seconds, &fraction) || !CalendarIsValid(&date)) {
+        self->stats.errors++;
+        return false;
+    }
+    ApplyReference(self, CalendarToDays(&date) * 86400UL + seconds, fraction);
+    return true;
+}
+
+static void ApplyReference(syncT self, uint32_t utc, uint32_t fraction) {
+    uint32_t localUtc, localFraction;
+    int32_t seconds;
+    int64_t offset = 0;
+
+    // El segundo puede cambiar en la interrupción del tick mientras se lee la fracción
+    do {
+        localUtc = ClockGetUtc(self->clock);
+        localFraction = ClockGetFraction(self->clock);
+    } while (localUtc != ClockGetUtc(self->clock));
+
+    seconds = (int32_t)(utc - localUtc);
+    if (seconds >= -1 && seconds <= 1) {
+        offset = (((int64_t)seconds * FRACTION + fraction - localFraction) * NANOSECONDS) / FRACTION;
+    }
+
+    self->stats.samples++;
+    if (!self->synchronized || seconds < -1 || seconds > 1 || llabs(offset) > SYNC_STEP_LIMIT * 1000000LL) {
+        // Un desfasaje grande se corrige con un salto, la deriva estimada se conserva
+        ClockSetUtc(self->clock, utc);
+        offset = ((int64_t)fraction * NANOSECONDS) / FRACTION;
+        self->stats.steps++;
+        self->synchronized = true;
+        self->driftUtc = utc;
+        self->driftOffset = offset;
+        self->trimIntegral = 0;
+    } else {
+        self->trimIntegral += (int64_t)self->stats.trim * (int32_t)(utc - self->lastUtc);
+        if ((int32_t)(utc - self->driftUtc) >= SYNC_DRIFT_INTERVAL) {
+            // La corrección que habría mantenido el desfasaje constante es la aplicada más la variación observada
+            int32_t interval = (int32_t)(utc - self->driftUtc);
+            int32_t measured = LimitTrim((self->trimIntegral + offset - self->driftOffset) / interval);
+
+            if (self->driftValid) {
+                self->stats.drift += (measured - self->stats.drift) / SYNC_DRIFT_GAIN;
+            } else {
+                self->stats.drift = measured;
+                self->driftValid = true;
+            }
+            self->driftUtc = utc;
+            self->driftOffset = offset;
+            self->trimIntegral = 0;
+        }
+    }
+
+    self->lastUtc = utc;
+    self->stats.offset = (int32_t)(offset / 1000);
+    self->stats.trim = LimitTrim(self->stats.drift + offset / SYNC_SLEW_TIME);
+    ClockSetTrim(self->clock, self->stats.trim);
+}
+
+/* === Public function implementation ============================================================================== */
+
+syncT SyncCreate(syncDriverT driver, clockT clock) {
+    syncT self = NULL;
+
+    if (driver && clock) {
+        self = malloc(sizeof(struct syncS));
+    }
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct syncS));
+        self->driver = driver;
+        self->clock = clock;
+    }
+    return self;
+}
+
+bool SyncPoll(syncT self) {
+    uint8_t data[SYNC_READ_SIZE];
+    uint16_t count;
+    bool applied = false;
+
+    if (!self) {
+        return false;
+    }
+    do {
+        count = self->driver->Read(data, sizeof(data));
+        for (uint16_t index = 0; index < count; index++) {
+            if (data[index] == '$') {
+                self->length = 0; // Cada sentencia comienza con $, lo anterior se descarta
+            }
+            if (data[index] == '\r' || data[index] == '\n') {
+                applied = (self->length > 0 && ProcessLine(self)) || applied;
+                self->length = 0;
+            } else if (self->length < SYNC_LINE_SIZE - 1) {
+                self->line[self->length++] = (char)data[index];
+            }
+        }
+    } while (count == sizeof(data));
+    return applied;
+}
+
+bool SyncGetStats(syncT self, syncStatsT * stats) {
+    if (!self || !stats) {
+        return false; // Protección ante NULL
+    }
+    memcpy(stats, &self->stats, sizeof(syncStatsT));
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
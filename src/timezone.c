@@ -0,0 +1,304 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file timezone.c
+ ** @brief Implementación del manejo de zonas horarias con reglas de horario de verano al estilo POSIX
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timezone.h"
+#include "calendar.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SECONDS_PER_HOUR 3600L
+#define SECONDS_PER_DAY  86400L
+
+#define DEFAULT_RULE_TIME (2 * SECONDS_PER_HOUR) //!< Hora local de la transición cuando la regla no la indica
+
+/* === Private data type declarations ============================================================================== */
+
+//! Regla de transición de la forma Mm.w.d/time
+typedef struct timezoneRuleS {
+    uint8_t month;   //!< Mes de la transición, de 1 a 12
+    uint8_t week;    //!< Semana del mes, de 1 a 5, donde 5 indica la última
+    uint8_t weekday; //!< Día de la semana, ver calendarWeekdays
+    int32_t time;    //!< Hora local de la transición en segundos desde la medianoche
+} timezoneRuleT;
+
+struct timezoneS {
+    int32_t standardOffset;                      //!< Desplazamiento respecto de UTC en horario estándar, en segundos
+    int32_t daylightOffset;                      //!< Desplazamiento respecto de UTC en horario de verano, en segundos
+    bool hasDaylight;                            //!< Indica si la zona tiene horario de verano
+    timezoneRuleT start;                         //!< Regla de inicio del horario de verano
+    timezoneRuleT end;                           //!< Regla de fin del horario de verano
+    char description[TIMEZONE_DESCRIPTION_SIZE]; //!< Descripción con la que se creó la zona
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief  Avanza sobre el nombre de una zona, alfabético de al menos tres letras o encerrado entre `<` y `>`.
+ *
+ * @param text  Cadena a analizar.
+ * @return const char* Posición siguiente al nombre, o NULL si no hay un nombre válido.
+ */
+static const char * ParseName(const char * text);
+
+/**
+ * @brief  Analiza un valor de tiempo con el formato `[+|-]hh[:mm[:ss]]`.
+ *
+ * @param text  Cadena a analizar.
+ * @param seconds  Puntero donde se almacena el valor en segundos.
+ * @return const char* Posición siguiente al valor, o NULL si no hay un valor válido.
+ */
+static const char * ParseTime(const char * text, int32_t * seconds);
+
+/**
+ * @brief  Analiza una regla de transición con el formato `Mm.w.d[/time]`.
+ *
+ * @param text  Cadena a analizar.
+ * @param rule  Puntero donde se almacena la regla.
+ * @return const char* Posición siguiente a la regla, o NULL si no hay una regla válida.
+ */
+static const char * ParseRule(const char * text, timezoneRuleT * rule);
+
+/**
+ * @brief  Analiza un número decimal sin signo acotado.
+ *
+ * @param text  Cadena a analizar.
+ * @param max  Valor máximo permitido.
+ * @param value  Puntero donde se almacena el número.
+ * @return const char* Posición siguiente al número, o NULL si no hay un número válido.
+ */
+static const char * ParseNumber(const char * text, uint32_t max, uint32_t * value);
+
+/**
+ * @brief  Calcula el instante UTC en que se aplica una regla de transición en un año dado.
+ *
+ * @param rule  Regla de transición.
+ * @param year  Año en el que se evalúa la regla.
+ * @param offset  Desplazamiento vigente antes de la transición, en segundos.
+ * @return int64_t Instante UTC de la transición en segundos desde la época.
+ */
+static int64_t RuleInstant(const timezoneRuleT * rule, uint16_t year, int32_t offset);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static const char * ParseName(const char * text) {
+    const char * start = text;
+
+    if (*text == '<') {
+        while (*text && *text != '>') {
+            text++;
+        }
+        return (*text == '>' && text - start > 3) ? text + 1 : NULL;
+    }
+    while ((*text >= 'A' && *text <= 'Z') || (*text >= 'a' && *text <= 'z')) {
+        text++;
+    }
+    return (text - start >= 3) ? text : NULL;
+}
+
+static const char * ParseNumber(const char * text, uint32_t max, uint32_t * value) {
+    const char * start = text;
+
+    *value = 0;
+    while (text && *text >= '0' && *text <= '9') {
+        *value = *value * 10 + (uint32_t)(*text - '0');
+        text++;
+        if (*value > max) {
+            return NULL;
+        }
+    }
+    return (text != start) ? text : NULL;
+}
+
+static const char * ParseTime(const char * text, int32_t * seconds) {
+    uint32_t hours, minutes = 0, secs = 0;
+    int32_t sign = 1;
+
+    if (*text == '+' || *text == '-') {
+        sign = (*text == '-') ? -1 : 1;
+        text++;
+    }
+    text = ParseNumber(text, 167, &hours);
+    if (text && *text == ':') {
+        text = ParseNumber(text + 1, 59, &minutes);
+        if (text && *text == ':') {
+            text = ParseNumber(text + 1, 59, &secs);
+        }
+    }
+    if (text) {
+        *seconds = sign * (int32_t)(hours * SECONDS_PER_HOUR + minutes * 60 + secs);
+    }
+    return text;
+}
+
+static const char * ParseRule(const char * text, timezoneRuleT * rule) {
+    uint32_t month, week, weekday;
+
+    if (*text != 'M') {
+        return NULL; // Solo se admiten reglas de la forma Mm.w.d
+    }
+    text = ParseNumber(text + 1, 12, &month);
+    if (!text || *text != '.' || month < 1) {
+        return NULL;
+    }
+    text = ParseNumber(text + 1, 5, &week);
+    if (!text || *text != '.' || week < 1) {
+        return NULL;
+    }
+    text = ParseNumber(text + 1, 6, &weekday);
+    if (!text) {
+        return NULL;
+    }
+
+    rule->month = month;
+    rule->week = week;
+    rule->weekday = weekday;
+    rule->time = DEFAULT_RULE_TIME;
+    if (*text == '/') {
+        text = ParseTime(text + 1, &rule->time);
+    }
+    return text;
+}
+
+static int64_t RuleInstant(const timezoneRuleT * rule, uint16_t year, int32_t offset) {
+    uint32_t first = CalendarToDays(&(calendarDateT){.year = year, .month = rule->month, .day = 1});
+    uint32_t next = (rule->month == 12) ? CalendarToDays(&(calendarDateT){.year = year + 1, .month = 1, .day = 1})
+                                        : CalendarToDays(&(calendarDateT){.year = year, .month = rule->month + 1, .day = 1});
+    uint32_t day = first + (rule->weekday + 7 - CalendarWeekday(first)) % 7 + (rule->week - 1) * 7;
+
+    if (day >= next) {
+        day -= 7; // La semana 5 indica la última ocurrencia del día en el mes
+    }
+    return (int64_t)day * SECONDS_PER_DAY + rule->time - offset;
+}
+
+/* === Public function implementation ============================================================================== */
+
+timezoneT TimezoneCreate(const char * description) {
+    struct timezoneS zone = {0};
+    int32_t offset;
+    timezoneT self;
+
+    if (!description || strlen(description) >= sizeof(zone.description)) {
+        return NULL; // Protección ante NULL o una descripción que no se podría guardar completa
+    }
+
+    const char * text = ParseName(description);
+    text = text ? ParseTime(text, &offset) : NULL;
+    if (!text) {
+        return NULL;
+    }
+    zone.standardOffset = -offset; // POSIX expresa el desplazamiento hacia el oeste
+
+    if (*text) {
+        text = ParseName(text);
+        if (!text) {
+            return NULL;
+        }
+        zone.hasDaylight = true;
+        zone.daylightOffset = zone.standardOffset + SECONDS_PER_HOUR;
+        if (*text && *text != ',') {
+            text = ParseTime(text, &offset);
+            if (!text) {
+                return NULL;
+            }
+            zone.daylightOffset = -offset;
+        }
+        if (*text != ',') {
+            return NULL; // Sin reglas no se puede precalcular la transición
+        }
+        text = ParseRule(text + 1, &zone.start);
+        if (!text || *text != ',') {
+            return NULL;
+        }
+        text = ParseRule(text + 1, &zone.end);
+        if (!text || *text) {
+            return NULL;
+        }
+    }
+
+    strcpy(zone.description, description);
+    self = malloc(sizeof(struct timezoneS));
+    if (self != NULL) {
+        *self = zone;
+    }
+    return self;
+}
+
+void TimezoneDestroy(timezoneT self) {
+    free(self);
+}
+
+const char * TimezoneGetDescription(timezoneT self) {
+    return self ? self->description : NULL;
+}
+
+int32_t TimezoneOffset(timezoneT self, uint32_t utc, uint32_t * next) {
+    calendarDateT date;
+    int32_t offset;
+    int64_t previous = INT64_MIN;
+    int64_t following = INT64_MAX;
+
+    if (!self) {
+        if (next) {
+            *next = TIMEZONE_NO_TRANSITION;
+        }
+        return 0;
+    }
+
+    offset = self->standardOffset;
+    if (self->hasDaylight) {
+        // Se evalúan las transiciones del año anterior, el actual y el siguiente para cubrir ambos hemisferios
+        CalendarFromDays(utc / SECONDS_PER_DAY, &date);
+        uint16_t first = (date.year > CALENDAR_EPOCH_YEAR) ? date.year - 1 : date.year;
+        for (uint16_t year = first; year <= date.year + 1; year++) {
+            int64_t transitions[2] = {RuleInstant(&self->start, year, self->standardOffset),
+                                      RuleInstant(&self->end, year, self->daylightOffset)};
+            for (int index = 0; index < 2; index++) {
+                if (transitions[index] <= (int64_t)utc && transitions[index] > previous) {
+                    previous = transitions[index];
+                    offset = index == 0 ? self->daylightOffset : self->standardOffset;
+                } else if (transitions[index] > (int64_t)utc && transitions[index] < following) {
+                    following = transitions[index];
+                }
+            }
+        }
+    }
+
+    if (next) {
+        *next = (following < TIMEZONE_NO_TRANSITION) ? (uint32_t)following : TIMEZONE_NO_TRANSITION;
+    }
+    return offset;
+}
+
+/* === End of documentation ======================================================================================== */
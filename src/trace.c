@@ -0,0 +1,85 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace.c
+ ** @brief Implementación del registro binario de eventos en un buffer circular
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TRACE_MASK (TRACE_SIZE - 1) //!< Máscara para obtener la posición en el buffer a partir del número de registro
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static traceRecordT records[TRACE_SIZE];
+static uint32_t head = 0; //!< Número del próximo registro, crece sin límite y se reduce con TRACE_MASK
+static const volatile uint32_t * time = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void TraceInit(const volatile uint32_t * timestamp) {
+    memset(records, 0, sizeof(records));
+    __atomic_store_n(&head, 0, __ATOMIC_RELAXED);
+    time = timestamp;
+}
+
+void TraceRecord(traceEvents event, uint16_t data) {
+    // En el Cortex-M4 el incremento atómico se resuelve con LDREX/STREX, una interrupción solo obliga a reintentar
+    traceRecordT * record = &records[__atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & TRACE_MASK];
+
+    record->timestamp = time ? *time : 0;
+    record->event = event;
+    record->reserved = 0;
+    record->data = data;
+}
+
+uint16_t TraceRead(uint32_t * cursor, traceRecordT * result, uint16_t count) {
+    uint32_t newest = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    uint32_t oldest = (newest > TRACE_SIZE) ? newest - TRACE_SIZE : 0;
+    uint16_t copied = 0;
+
+    if (!cursor || !result) {
+        return 0; // Protección ante NULL
+    }
+    if (*cursor - oldest > newest - oldest) {
+        *cursor = oldest; // Los registros de esa posición ya se sobrescribieron
+    }
+    while (*cursor != newest && copied < count) {
+        result[copied++] = records[*cursor & TRACE_MASK];
+        (*cursor)++;
+    }
+    return copied;
+}
+
+/* === End of documentation ======================================================================================== */
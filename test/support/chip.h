@@ -0,0 +1,93 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/** @file chip.h
+ ** @brief Reemplazo en el host de las funciones de GPIO de la biblioteca del fabricante, para probar los módulos
+ **        que manejan pines sin el microcontrolador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define LPC_GPIO_PORT (&hostGpio) //!< Controlador de GPIO simulado
+
+/* === Public data type declarations =============================================================================== */
+
+//! Registros del controlador de GPIO, con la misma distribución que en el LPC43xx
+typedef struct {
+    uint8_t B[128][32];
+    uint32_t W[32][32];
+    uint32_t RESERVED0[1024];
+    uint32_t DIR[32];
+    uint32_t MASK[32];
+    uint32_t PIN[32];
+    uint32_t MPIN[32];
+    uint32_t SET[32];
+    uint32_t CLR[32];
+    uint32_t NOT[32];
+} LPC_GPIO_T;
+
+/* === Public variable declarations ================================================================================ */
+
+extern LPC_GPIO_T hostGpio;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Pone todos los registros del GPIO simulado en cero y la cuenta de escrituras en cero.
+ */
+void HostGpioReset(void);
+
+/**
+ * @brief Obtiene la cantidad de escrituras a los pines de salida desde el último reinicio.
+ *
+ * @return uint32_t Cantidad de llamadas que modificaron pines.
+ */
+uint32_t HostGpioWrites(void);
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool state);
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output);
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin);
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits);
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits);
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t value);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
@@ -0,0 +1,104 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip_gpio.c
+ ** @brief Implementación en el host de las funciones de GPIO de la biblioteca del fabricante
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t writes;
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_GPIO_T hostGpio;
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void HostGpioReset(void) {
+    memset(&hostGpio, 0, sizeof(hostGpio));
+    writes = 0;
+}
+
+uint32_t HostGpioWrites(void) {
+    return writes;
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool state) {
+    if (state) {
+        gpio->PIN[port] |= 1UL << pin;
+    } else {
+        gpio->PIN[port] &= ~(1UL << pin);
+    }
+    writes++;
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    if (output) {
+        gpio->DIR[port] |= 1UL << pin;
+    } else {
+        gpio->DIR[port] &= ~(1UL << pin);
+    }
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->PIN[port] ^= 1UL << pin;
+    writes++;
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    return (gpio->PIN[port] >> pin) & 1;
+}
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits) {
+    gpio->PIN[port] |= bits;
+    writes++;
+}
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits) {
+    gpio->PIN[port] &= ~bits;
+    writes++;
+}
+
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    gpio->MASK[port] = mask;
+}
+
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t value) {
+    // Solo cambian los pines con el bit de la máscara en cero
+    gpio->MPIN[port] = value;
+    gpio->PIN[port] = (gpio->PIN[port] & gpio->MASK[port]) | (value & ~gpio->MASK[port]);
+    writes++;
+}
+
+/* === End of documentation ======================================================================================== */
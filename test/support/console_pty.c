@@ -0,0 +1,138 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file console_pty.c
+ ** @brief Implementación del driver de puerto serie sobre una pseudo-terminal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 600
+
+#include "console_pty.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CONSOLE_PTY_BUFFER 1024 //!< Bytes que se pueden escribir en la pseudo-terminal sin que se bloquee
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint16_t Read(uint8_t * data, uint16_t size);
+static uint16_t Write(const uint8_t * data, uint16_t size);
+static uint16_t Free(void);
+
+/**
+ * @brief Lee sin esperar de un descriptor abierto en modo no bloqueante.
+ *
+ * @param descriptor  Descriptor de archivo.
+ * @param data  Buffer donde se copian los bytes.
+ * @param size  Tamaño del buffer.
+ * @return uint16_t Cantidad de bytes leídos, cero si no había datos disponibles.
+ */
+static uint16_t ReadAvailable(int descriptor, void * data, uint16_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+static int master = -1;
+static int slave = -1;
+static const struct consoleDriverS driver = {.Read = Read, .Write = Write, .Free = Free};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t ReadAvailable(int descriptor, void * data, uint16_t size) {
+    ssize_t result = (descriptor < 0) ? -1 : read(descriptor, data, size);
+    return (result > 0) ? (uint16_t)result : 0;
+}
+
+static uint16_t Read(uint8_t * data, uint16_t size) {
+    return ReadAvailable(master, data, size);
+}
+
+static uint16_t Write(const uint8_t * data, uint16_t size) {
+    ssize_t result = (master < 0) ? -1 : write(master, data, size);
+    return (result > 0) ? (uint16_t)result : 0;
+}
+
+static uint16_t Free(void) {
+    return CONSOLE_PTY_BUFFER; // El núcleo no informa el espacio libre, se asume el mínimo que garantiza
+}
+
+/* === Public function implementation ============================================================================== */
+
+consoleDriverT ConsolePtyCreate(void) {
+    struct termios mode;
+
+    ConsolePtyClose();
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) || unlockpt(master)) {
+        ConsolePtyClose();
+        return NULL;
+    }
+    fcntl(master, F_SETFL, O_NONBLOCK);
+
+    // El extremo de la terminal se mantiene abierto para que la pseudo-terminal no se cierre sin usuario conectado
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (slave < 0 || tcgetattr(slave, &mode)) {
+        ConsolePtyClose();
+        return NULL;
+    }
+    // Modo crudo: sin eco, sin edición de línea y sin traducción de fin de línea, como un puerto serie
+    mode.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    mode.c_oflag &= ~OPOST;
+    mode.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    mode.c_cflag = (mode.c_cflag & ~(CSIZE | PARENB)) | CS8;
+    tcsetattr(slave, TCSANOW, &mode);
+
+    return &driver;
+}
+
+const char * ConsolePtyName(void) {
+    return (master < 0) ? NULL : ptsname(master);
+}
+
+uint16_t ConsolePtyType(const char * data, uint16_t size) {
+    ssize_t result = (slave < 0) ? -1 : write(slave, data, size);
+    return (result > 0) ? (uint16_t)result : 0;
+}
+
+uint16_t ConsolePtyReceive(char * data, uint16_t size) {
+    return ReadAvailable(slave, data, size);
+}
+
+void ConsolePtyClose(void) {
+    if (slave >= 0) {
+        close(slave);
+        slave = -1;
+    }
+    if (master >= 0) {
+        close(master);
+        master = -1;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,93 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CONSOLE_PTY_H_
+#define CONSOLE_PTY_H_
+
+/** @file console_pty.h
+ ** @brief Driver de puerto serie sobre una pseudo-terminal, para ejecutar la consola en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "console.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Abre una pseudo-terminal en modo crudo que reemplaza al puerto serie de la placa.
+ *
+ * @return consoleDriverT Driver del puerto serie, o NULL si no se pudo abrir la pseudo-terminal.
+ *
+ * @note Un programa de terminal (por ejemplo `screen` o `picocom`) puede conectarse al dispositivo que retorna
+ *       ConsolePtyName() para usar la consola del simulador.
+ */
+consoleDriverT ConsolePtyCreate(void);
+
+/**
+ * @brief Obtiene la ruta del extremo de la pseudo-terminal al que se conecta la terminal.
+ *
+ * @return const char* Ruta del dispositivo, o NULL si la pseudo-terminal no está abierta.
+ */
+const char * ConsolePtyName(void);
+
+/**
+ * @brief Escribe bytes desde el extremo de la terminal, como si los tipeara un usuario.
+ *
+ * @param data  Bytes a escribir.
+ * @param size  Cantidad de bytes.
+ * @return uint16_t Cantidad de bytes escritos.
+ */
+uint16_t ConsolePtyType(const char * data, uint16_t size);
+
+/**
+ * @brief Lee sin esperar los bytes que la consola transmitió hacia el extremo de la terminal.
+ *
+ * @param data  Buffer donde se copian los bytes.
+ * @param size  Tamaño del buffer.
+ * @return uint16_t Cantidad de bytes leídos.
+ */
+uint16_t ConsolePtyReceive(char * data, uint16_t size);
+
+/**
+ * @brief Cierra la pseudo-terminal.
+ */
+void ConsolePtyClose(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_PTY_H_ */
@@ -0,0 +1,90 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file core_thread.c
+ ** @brief Implementación del hilo del host que reemplaza al núcleo Cortex-M0
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 600
+
+#include "core_thread.h"
+#include <pthread.h>
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Punto de entrada del hilo, llama a la función indicada en CoreThreadStart.
+ *
+ * @param argument  No se usa.
+ * @return void* Siempre NULL.
+ */
+static void * Run(void * argument);
+
+/* === Private variable definitions ================================================================================ */
+
+static pthread_t thread;
+static bool started = false;
+static volatile bool running = false;
+static coreThreadEntryT threadEntry = NULL;
+static void * threadContext = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void * Run(void * argument) {
+    (void)argument;
+    threadEntry(threadContext);
+    return NULL;
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool CoreThreadStart(coreThreadEntryT entry, void * context) {
+    if (started || !entry) {
+        return false;
+    }
+    threadEntry = entry;
+    threadContext = context;
+    __atomic_store_n(&running, true, __ATOMIC_SEQ_CST);
+    started = (pthread_create(&thread, NULL, Run, NULL) == 0);
+    return started;
+}
+
+void CoreThreadStop(void) {
+    __atomic_store_n(&running, false, __ATOMIC_SEQ_CST);
+    if (started) {
+        pthread_join(thread, NULL);
+        started = false;
+    }
+}
+
+bool CoreThreadRunning(void) {
+    return __atomic_load_n(&running, __ATOMIC_SEQ_CST);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,76 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CORE_THREAD_H_
+#define CORE_THREAD_H_
+
+/** @file core_thread.h
+ ** @brief Hilo del host que reemplaza al núcleo Cortex-M0, para ejecutar en paralelo el código de ambos núcleos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Función que ejecuta el hilo, repite su lazo mientras CoreThreadRunning() sea verdadero
+typedef void (*coreThreadEntryT)(void * context);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Arranca el hilo que reemplaza al núcleo secundario, como lo haría el núcleo principal al liberar su reset.
+ *
+ * @param entry     Función que ejecuta el hilo.
+ * @param context   Parámetro de la función.
+ * @return true Si se pudo crear el hilo y no había otro en ejecución.
+ */
+bool CoreThreadStart(coreThreadEntryT entry, void * context);
+
+/**
+ * @brief Indica al hilo que termine y espera a que salga de su lazo.
+ */
+void CoreThreadStop(void);
+
+/**
+ * @brief Indica si el hilo debe seguir ejecutando su lazo.
+ *
+ * @return true Mientras no se llame a CoreThreadStop.
+ */
+bool CoreThreadRunning(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CORE_THREAD_H_ */
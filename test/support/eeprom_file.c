@@ -0,0 +1,115 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file eeprom_file.c
+ ** @brief Implementación del driver de memoria no volátil respaldado por un archivo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "eeprom_file.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define EEPROM_FILE_MAX_SIZE 16384 //!< Tamaño máximo de la memoria simulada, igual a la EEPROM del LPC4337
+#define EEPROM_FILE_ERASED   0xFF  //!< Valor de la memoria borrada
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static bool Read(uint32_t address, void * data, uint16_t size);
+static bool Write(uint32_t address, const void * data, uint16_t size);
+static bool Busy(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static FILE * file;
+static uint32_t writes[EEPROM_FILE_MAX_SIZE];
+static struct storageDriverS driver = {.Read = Read, .Write = Write, .Busy = Busy};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool Read(uint32_t address, void * data, uint16_t size) {
+    if (!file || address + size > driver.size || fseek(file, address, SEEK_SET)) {
+        return false;
+    }
+    return fread(data, 1, size, file) == size;
+}
+
+static bool Write(uint32_t address, const void * data, uint16_t size) {
+    if (!file || address + size > driver.size || fseek(file, address, SEEK_SET)) {
+        return false;
+    }
+    for (uint32_t index = address; index < address + size; index++) {
+        writes[index]++;
+    }
+    return (fwrite(data, 1, size, file) == size) && !fflush(file);
+}
+
+static bool Busy(void) {
+    return false; // El archivo se escribe en forma inmediata
+}
+
+/* === Public function implementation ============================================================================== */
+
+storageDriverT EepromFileCreate(const char * path, uint32_t size) {
+    uint8_t erased[128];
+
+    EepromFileClose();
+    if (size > EEPROM_FILE_MAX_SIZE) {
+        return NULL;
+    }
+
+    file = fopen(path, "r+b");
+    if (!file) {
+        file = fopen(path, "w+b");
+        memset(erased, EEPROM_FILE_ERASED, sizeof(erased));
+        for (uint32_t written = 0; file && written < size; written += sizeof(erased)) {
+            fwrite(erased, 1, sizeof(erased), file);
+        }
+    }
+    memset(writes, 0, sizeof(writes));
+    driver.size = size;
+    return file ? &driver : NULL;
+}
+
+void EepromFileClose(void) {
+    if (file) {
+        fclose(file);
+        file = NULL;
+    }
+}
+
+uint32_t EepromFileWrites(uint32_t address, uint32_t size) {
+    uint32_t result = 0;
+
+    for (uint32_t index = address; index < address + size && index < EEPROM_FILE_MAX_SIZE; index++) {
+        result = writes[index] > result ? writes[index] : result;
+    }
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
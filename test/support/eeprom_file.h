@@ -0,0 +1,77 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef EEPROM_FILE_H_
+#define EEPROM_FILE_H_
+
+/** @file eeprom_file.h
+ ** @brief Driver de memoria no volátil respaldado por un archivo, para ejecutar el almacenamiento en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "storage.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Abre el archivo que simula la memoria, creándolo borrado si no existe.
+ *
+ * @param path  Ruta del archivo.
+ * @param size  Tamaño de la memoria simulada en bytes.
+ * @return storageDriverT Driver de la memoria, o NULL si no se pudo abrir el archivo.
+ */
+storageDriverT EepromFileCreate(const char * path, uint32_t size);
+
+/**
+ * @brief Cierra el archivo que simula la memoria.
+ */
+void EepromFileClose(void);
+
+/**
+ * @brief Obtiene la cantidad de escrituras realizadas sobre un rango de la memoria desde que se abrió el archivo.
+ *
+ * @param address  Dirección inicial del rango.
+ * @param size  Tamaño del rango en bytes.
+ * @return uint32_t Cantidad de escrituras que afectaron al rango.
+ */
+uint32_t EepromFileWrites(uint32_t address, uint32_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EEPROM_FILE_H_ */
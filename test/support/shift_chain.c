@@ -0,0 +1,90 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file shift_chain.c
+ ** @brief Implementación de la simulación de una cadena de registros 74HC595
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "shift_chain.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t count;                                //!< Cantidad de registros de la cadena
+static uint8_t shifter[SHIFT_CHAIN_MAX_REGISTERS];   //!< Registros de desplazamiento internos
+static uint8_t outputs[SHIFT_CHAIN_MAX_REGISTERS];   //!< Registros de salida, se cargan con el latch
+static uint16_t latches;
+static uint16_t lastBits;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void ShiftChainInit(uint8_t registers) {
+    count = (registers > SHIFT_CHAIN_MAX_REGISTERS) ? SHIFT_CHAIN_MAX_REGISTERS : registers;
+    memset(shifter, 0, sizeof(shifter));
+    memset(outputs, 0, sizeof(outputs));
+    latches = 0;
+    lastBits = 0;
+}
+
+void ShiftChainSend(const uint8_t * data, uint8_t size) {
+    uint8_t carry;
+
+    lastBits = 0;
+    for (uint8_t index = 0; index < size; index++) {
+        for (int8_t bit = 7; bit >= 0; bit--) {
+            // Cada flanco del reloj mueve QH de un registro a la entrada serie del siguiente
+            carry = (data[index] >> bit) & 1;
+            for (uint8_t chip = 0; chip < count; chip++) {
+                uint8_t next = shifter[chip] >> 7;
+                shifter[chip] = (uint8_t)((shifter[chip] << 1) | carry);
+                carry = next;
+            }
+            lastBits++;
+        }
+    }
+    memcpy(outputs, shifter, sizeof(outputs));
+    latches++;
+}
+
+uint8_t ShiftChainOutput(uint8_t index) {
+    return (index < count) ? outputs[index] : 0;
+}
+
+uint16_t ShiftChainLatches(void) {
+    return latches;
+}
+
+uint16_t ShiftChainLastBits(void) {
+    return lastBits;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,92 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SHIFT_CHAIN_H_
+#define SHIFT_CHAIN_H_
+
+/** @file shift_chain.h
+ ** @brief Simulación de una cadena de registros 74HC595, para verificar en el host la trama del driver de pantalla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define SHIFT_CHAIN_MAX_REGISTERS 4 //!< Cantidad máxima de registros de la cadena simulada
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Reinicia la cadena simulada con todas las salidas en cero.
+ *
+ * @param registers Cantidad de registros de la cadena.
+ */
+void ShiftChainInit(uint8_t registers);
+
+/**
+ * @brief Desplaza los bytes bit a bit por la cadena, el más significativo primero como el SSP, y luego los copia a
+ *        las salidas con un flanco del latch.
+ *
+ * @param data  Bytes a desplazar.
+ * @param size  Cantidad de bytes.
+ */
+void ShiftChainSend(const uint8_t * data, uint8_t size);
+
+/**
+ * @brief Obtiene las salidas QA a QH de un registro, en los bits 0 a 7.
+ *
+ * @param index Posición del registro, el cero es el conectado al microcontrolador.
+ * @return uint8_t Estado de las salidas luego del último latch.
+ */
+uint8_t ShiftChainOutput(uint8_t index);
+
+/**
+ * @brief Obtiene la cantidad de tramas recibidas desde que se reinició la cadena.
+ *
+ * @return uint16_t Cantidad de flancos del latch.
+ */
+uint16_t ShiftChainLatches(void);
+
+/**
+ * @brief Obtiene la cantidad de bits desplazados en la última trama.
+ *
+ * @return uint16_t Cantidad de flancos del reloj de desplazamiento.
+ */
+uint16_t ShiftChainLastBits(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHIFT_CHAIN_H_ */
@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace_decoder.c
+ ** @brief Implementación del decodificador de los registros de eventos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace_decoder.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const EVENT_NAMES[TRACE_EVENTS] = {
+    [TRACE_MODE] = "mode",           [TRACE_KEY] = "key",
+    [TRACE_ALARM_RING] = "ring",     [TRACE_ALARM_SNOOZE] = "snooze",
+    [TRACE_ALARM_CANCEL] = "cancel", [TRACE_ALARM_ENABLE] = "alarm",
+    [TRACE_SET_TIME] = "set time",   [TRACE_SET_ALARM] = "set alarm",
+    [TRACE_REMOTE] = "remote",       [TRACE_TICK_CYCLES] = "tick cycles",
+    [TRACE_SCAN_CYCLES] = "scan cycles", [TRACE_WAKE] = "wake",
+    [TRACE_POWER] = "power",
+};
+
+static const char * const KEY_NAMES[] = {
+    [TRACE_KEY_SET_TIME] = "set time", [TRACE_KEY_SET_ALARM] = "set alarm", [TRACE_KEY_DECREMENT] = "decrement",
+    [TRACE_KEY_INCREMENT] = "increment", [TRACE_KEY_ACCEPT] = "accept",     [TRACE_KEY_CANCEL] = "cancel",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+bool TraceDecoderParse(const char * line, traceRecordT * record) {
+    unsigned long timestamp;
+    unsigned int event, data;
+    int length = 0;
+
+    if (!line || !record) {
+        return false;
+    }
+    if (sscanf(line, "trace %8lx %2x %4x%n", &timestamp, &event, &data, &length) != 3 || length != 22) {
+        return false;
+    }
+    record->timestamp = (uint32_t)timestamp;
+    record->event = (uint8_t)event;
+    record->reserved = 0;
+    record->data = (uint16_t)data;
+    return true;
+}
+
+int TraceDecoderFormat(const traceRecordT * record, char * text, size_t size) {
+    unsigned long seconds = record->timestamp / 1000;
+    unsigned long milliseconds = record->timestamp % 1000;
+
+    if (record->event >= TRACE_EVENTS) {
+        return snprintf(text, size, "%lu.%03lu unknown %u %u", seconds, milliseconds, record->event, record->data);
+    }
+    switch (record->event) {
+    case TRACE_KEY:
+        if (record->data < sizeof(KEY_NAMES) / sizeof(KEY_NAMES[0])) {
+            return snprintf(text, size, "%lu.%03lu key %s", seconds, milliseconds, KEY_NAMES[record->data]);
+        }
+        break;
+    case TRACE_SET_TIME:
+    case TRACE_SET_ALARM:
+        return snprintf(text, size, "%lu.%03lu %s %02X:%02X", seconds, milliseconds, EVENT_NAMES[record->event],
+                        record->data >> 8, record->data & 0xFF);
+    case TRACE_ALARM_RING:
+    case TRACE_ALARM_CANCEL:
+    case TRACE_REMOTE:
+        return snprintf(text, size, "%lu.%03lu %s", seconds, milliseconds, EVENT_NAMES[record->event]);
+    case TRACE_ALARM_ENABLE:
+        return snprintf(text, size, "%lu.%03lu alarm %s", seconds, milliseconds, record->data ? "on" : "off");
+    default:
+        break;
+    }
+    return snprintf(text, size, "%lu.%03lu %s %u", seconds, milliseconds, EVENT_NAMES[record->event], record->data);
+}
+
+/* === End of documentation ======================================================================================== */
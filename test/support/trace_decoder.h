@@ -0,0 +1,76 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_DECODER_H_
+#define TRACE_DECODER_H_
+
+/** @file trace_decoder.h
+ ** @brief Decodificador en el host de los registros de eventos volcados por la consola
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Interpreta una línea del volcado con formato `trace TTTTTTTT EE DDDD`.
+ *
+ * @param line  Línea recibida, con o sin fin de línea.
+ * @param record  Puntero donde se almacena el registro.
+ * @return true Si la línea corresponde a un registro.
+ */
+bool TraceDecoderParse(const char * line, traceRecordT * record);
+
+/**
+ * @brief Describe un registro en texto legible, por ejemplo `12.345 key accept`.
+ *
+ * @param record  Registro a describir.
+ * @param text  Buffer donde se escribe la descripción.
+ * @param size  Tamaño del buffer.
+ * @return int Cantidad de caracteres de la descripción completa, como snprintf.
+ *
+ * @note La marca de tiempo se interpreta en milisegundos, la base de tiempo que usa el firmware.
+ */
+int TraceDecoderFormat(const traceRecordT * record, char * text, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_DECODER_H_ */
@@ -0,0 +1,460 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_app.c
+ ** @brief Archivo de pruebas unitarias para la lógica de la interfaz del reloj, con tiempo y salidas simuladas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "app.h"
+#include "clock.h"
+#include "calendar.h"
+#include "screen.h"
+#include "timezone.h"
+#include "trace.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_TICKS_PER_SECOND 10 //!< Ticks por segundo del reloj simulado, pocos para cubrir varios días de tiempo
+
+#define TEST_RANDOM_EVENTS 2000000 //!< Cantidad de eventos de la ejecución aleatoria
+#define TEST_RANDOM_SEED   0x2545F491 //!< Semilla de la ejecución aleatoria, la misma en cada corrida
+
+#define TEST_ALARM_DOT SCREEN_FRAME_DOT(3) //!< Punto que indica la alarma activada
+#define TEST_VALID_FRAMES (24 * 60)         //!< Cantidad de horas y minutos que se pueden mostrar
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdates(uint8_t segments);
+static void FakeDigitTurnOn(uint8_t digit);
+
+static void FakeRingingLed(bool on);
+static void FakeAlarmLed(uint8_t duty);
+static void FakeSound(bool play);
+static void FakeNotify(const char * event);
+static void FakeSave(const clockStateT * state);
+
+/**
+ * @brief Función de alarma del reloj, avisa a la interfaz igual que el programa principal.
+ */
+static void AlarmRinging(clockT clock);
+
+/**
+ * @brief Arma una hora con segundos a partir de horas, minutos y segundos.
+ */
+static clockTimeT MakeTime(uint8_t hours, uint8_t minutes, uint8_t seconds);
+
+/**
+ * @brief Avanza el tiempo simulado y la interfaz una cantidad de segundos completos.
+ */
+static void AdvanceSeconds(uint32_t seconds);
+
+/**
+ * @brief Obtiene el cuadro de cuatro dígitos que muestra la pantalla, sin los puntos fijos.
+ */
+static uint32_t ShownFrame(void);
+
+/**
+ * @brief Compara dos cuadros para ordenar y buscar en la tabla de cuadros válidos.
+ */
+static int CompareFrames(const void * a, const void * b);
+
+/**
+ * @brief Indica si un cuadro, sin el punto de la alarma, muestra una hora y minutos válidos.
+ */
+static bool IsValidFrame(uint32_t frame);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screenDriverS screenDriver = {
+    .DigitsTurnOff = FakeDigitsTurnOff, .SegmentsUpdates = FakeSegmentsUpdates, .DigitTurnOn = FakeDigitTurnOn};
+
+static const struct appDriverS appDriver = {
+    .RingingLed = FakeRingingLed,
+    .AlarmLed = FakeAlarmLed,
+    .Sound = FakeSound,
+    .Notify = FakeNotify,
+    .Save = FakeSave,
+};
+
+static volatile uint32_t now; //!< Tiempo simulado, en ticks
+static clockT appClock;
+static screenT screen;
+static appT app;
+
+static bool ringingLed;
+static uint8_t alarmDuty;
+static bool sounding;
+static const char * lastEvent;
+static uint16_t saves;
+
+static uint32_t validFrames[TEST_VALID_FRAMES]; //!< Cuadros de todas las horas y minutos, ordenados
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+}
+
+static void FakeSegmentsUpdates(uint8_t segments) {
+    (void)segments;
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    (void)digit;
+}
+
+static void FakeRingingLed(bool on) {
+    ringingLed = on;
+}
+
+static void FakeAlarmLed(uint8_t duty) {
+    alarmDuty = duty;
+}
+
+static void FakeSound(bool play) {
+    sounding = play;
+}
+
+static void FakeNotify(const char * event) {
+    lastEvent = event;
+}
+
+static void FakeSave(const clockStateT * state) {
+    TEST_ASSERT_NOT_NULL(state);
+    saves++;
+}
+
+static void AlarmRinging(clockT clock) {
+    (void)clock;
+    AppAlarmRinging(app);
+}
+
+static clockTimeT MakeTime(uint8_t hours, uint8_t minutes, uint8_t seconds) {
+    clockTimeT time = {.bcd = {seconds % 10, seconds / 10, minutes % 10, minutes / 10, hours % 10, hours / 10}};
+
+    return time;
+}
+
+static void AdvanceSeconds(uint32_t seconds) {
+    for (uint32_t tick = 0; tick < seconds * TEST_TICKS_PER_SECOND; tick++) {
+        now++;
+        AppTick(app, 1);
+    }
+}
+
+static uint32_t ShownFrame(void) {
+    screenStateT state;
+
+    ScreenGetState(screen, &state);
+    return state.value[0] | state.value[1] << 8 | state.value[2] << 16 | (uint32_t)state.value[3] << 24;
+}
+
+static int CompareFrames(const void * a, const void * b) {
+    uint32_t first = *(const uint32_t *)a;
+    uint32_t second = *(const uint32_t *)b;
+
+    return (first > second) - (first < second);
+}
+
+static bool IsValidFrame(uint32_t frame) {
+    frame &= ~TEST_ALARM_DOT;
+    return bsearch(&frame, validFrames, TEST_VALID_FRAMES, sizeof(validFrames[0]), CompareFrames) != NULL;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Sin una hora válida la interfaz espera que se configure la hora.
+ * - Con una hora válida, por ejemplo restaurada, la interfaz muestra la hora en cada tick.
+ * - Con la configuración restaurada al arrancar se pide confirmar la hora guardada y la alarma no suena antes.
+ * - Configurar la hora con las teclas, mostrarla y guardarla.
+ * - Sin una hora válida, al terminar de configurar la hora o la alarma se vuelve a esperar la configuración.
+ * - Hacer sonar la alarma, posponerla y cancelarla con las teclas.
+ * - Al superar el límite de posposiciones la tecla de aceptar no silencia la alarma.
+ * - Configurar la hora desde la consola muestra la hora.
+ * - El brillo se atenúa de noche y no supera el límite asignado.
+ * - Una secuencia aleatoria de millones de eventos con tiempo simulado mantiene los invariantes de la interfaz.
+ */
+
+void setUp(void) {
+    now = 0;
+    ringingLed = false;
+    alarmDuty = 0;
+    sounding = false;
+    lastEvent = NULL;
+    saves = 0;
+
+    TraceInit(&now);
+    appClock = ClockCreate(TEST_TICKS_PER_SECOND, AlarmRinging);
+    screen = ScreenCreate(4, &screenDriver);
+    app = AppCreate(appClock, screen, &appDriver);
+}
+
+// Sin una hora válida la interfaz espera que se configure la hora.
+void test_starts_unconfigured(void) {
+    TEST_ASSERT_NOT_NULL(app);
+    TEST_ASSERT_NULL(AppCreate(appClock, screen, NULL));
+
+    AppStart(app);
+    TEST_ASSERT_EQUAL(APP_UNCONFIGURED, AppGetMode(app));
+    TEST_ASSERT_EQUAL_STRING("mode unconfigured", lastEvent);
+}
+
+// Con una hora válida, por ejemplo restaurada, la interfaz muestra la hora en cada tick.
+void test_starts_showing_valid_time(void) {
+    clockTimeT time = MakeTime(12, 34, 58);
+
+    ClockSetTime(appClock, &time);
+    AppStart(app);
+    TEST_ASSERT_EQUAL(APP_SHOW_TIME, AppGetMode(app));
+
+    AdvanceSeconds(2);
+    TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(0x1235), ShownFrame());
+}
+
+// Con la configuración restaurada al arrancar se pide confirmar la hora guardada y la alarma no suena antes.
+void test_restored_settings_confirm_time(void) {
+    clockTimeT time = MakeTime(6, 59, 59);
+    clockTimeT alarm = MakeTime(7, 0, 0);
+    clockStateT state;
+
+    ClockSetTime(appClock, &time);
+    ClockSetAlarm(appClock, &alarm);
+    ClockGetState(appClock, &state);
+    appClock = ClockCreate(TEST_TICKS_PER_SECOND, AlarmRinging);
+    app = AppCreate(appClock, screen, &appDriver);
+
+    TEST_ASSERT_TRUE(ClockRestoreSettings(appClock, &state));
+    AppStart(app);
+    TEST_ASSERT_EQUAL(APP_UNCONFIGURED, AppGetMode(app));
+    AdvanceSeconds(5);
+    TEST_ASSERT_FALSE(sounding);
+
+    // La edición comienza en la hora guardada, alcanza con aceptarla
+    AppKey(app, APP_KEY_SET_TIME);
+    AppKey(app, APP_KEY_ACCEPT);
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL(APP_SHOW_TIME, AppGetMode(app));
+    AppTick(app, 1);
+    TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(0x0659) | TEST_ALARM_DOT, ShownFrame());
+}
+
+// Configurar la hora con las teclas, mostrarla y guardarla.
+void test_set_time_with_keys(void) {
+    AppStart(app);
+    AppKey(app, APP_KEY_SET_TIME);
+    TEST_ASSERT_EQUAL(APP_SET_CURRENT_MINUTES, AppGetMode(app));
+    AppKey(app, APP_KEY_DECREMENT);
+    TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(0x0059), ShownFrame());
+
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL(APP_SET_CURRENT_HOURS, AppGetMode(app));
+    AppKey(app, APP_KEY_DECREMENT);
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL(APP_SHOW_TIME, AppGetMode(app));
+    TEST_ASSERT_EQUAL(1, saves);
+
+    AppTick(app, 1);
+    TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(0x2359), ShownFrame());
+}
+
+// Sin una hora válida, al terminar de configurar la hora o la alarma se vuelve a esperar la configuración.
+void test_setting_without_valid_time(void) {
+    AppStart(app);
+    AppKey(app, APP_KEY_SET_TIME);
+    AppKey(app, APP_KEY_INCREMENT);
+    AppKey(app, APP_KEY_CANCEL);
+    TEST_ASSERT_EQUAL(APP_UNCONFIGURED, AppGetMode(app));
+    TEST_ASSERT_EQUAL(0, saves);
+
+    AppKey(app, APP_KEY_SET_ALARM);
+    AppKey(app, APP_KEY_ACCEPT);
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL(APP_UNCONFIGURED, AppGetMode(app));
+}
+
+// Hacer sonar la alarma, posponerla y cancelarla con las teclas.
+void test_alarm_snooze_and_cancel(void) {
+    clockTimeT time = MakeTime(6, 59, 59);
+    clockTimeT alarm = MakeTime(7, 0, 0);
+
+    ClockSetTime(appClock, &time);
+    ClockSetAlarm(appClock, &alarm);
+    AppStart(app);
+    AppTick(app, 1);
+    TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(0x0659) | TEST_ALARM_DOT, ShownFrame());
+    TEST_ASSERT_NOT_EQUAL(0, alarmDuty);
+
+    AdvanceSeconds(1);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(appClock));
+    TEST_ASSERT_TRUE(sounding);
+    TEST_ASSERT_TRUE(ringingLed);
+
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_FALSE(sounding);
+    TEST_ASSERT_EQUAL_STRING("alarm snooze", lastEvent);
+    AppTick(app, 1);
+    TEST_ASSERT_FALSE(ringingLed);
+
+    AdvanceSeconds(5 * 60);
+    TEST_ASSERT_TRUE(sounding);
+    AppKey(app, APP_KEY_CANCEL);
+    TEST_ASSERT_FALSE(sounding);
+    TEST_ASSERT_EQUAL_STRING("alarm cancel", lastEvent);
+}
+
+// Al superar el límite de posposiciones la tecla de aceptar no silencia la alarma.
+void test_snooze_limit_keeps_sound(void) {
+    clockTimeT time = MakeTime(6, 59, 59);
+    clockTimeT alarm = MakeTime(7, 0, 0);
+
+    ClockSetTime(appClock, &time);
+    ClockSetAlarm(appClock, &alarm);
+    ClockSetSnoozeLimit(appClock, 1);
+    AppStart(app);
+    AdvanceSeconds(1);
+    AppKey(app, APP_KEY_ACCEPT);
+    TEST_ASSERT_FALSE(sounding);
+
+    AdvanceSeconds(5 * 60);
+    TEST_ASSERT_TRUE(sounding);
+    lastEvent = NULL;
+    AppKey(app, APP_KEY_ACCEPT);
+    AdvanceSeconds(1);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(appClock));
+    TEST_ASSERT_TRUE(sounding);
+    TEST_ASSERT_TRUE(ringingLed);
+    TEST_ASSERT_NULL(lastEvent);
+}
+
+// Configurar la hora desde la consola muestra la hora.
+void test_remote_change_shows_time(void) {
+    clockTimeT time = MakeTime(8, 15, 0);
+
+    AppStart(app);
+    ClockSetTime(appClock, &time);
+    AppRemoteChanged(app);
+    TEST_ASSERT_EQUAL(APP_SHOW_TIME, AppGetMode(app));
+    TEST_ASSERT_EQUAL(1, saves);
+}
+
+// El brillo se atenúa de noche y no supera el límite asignado.
+void test_brightness_night_and_limit(void) {
+    clockTimeT time = MakeTime(21, 59, 59);
+    screenStateT state;
+
+    ClockSetTime(appClock, &time);
+    AppStart(app);
+    ScreenGetState(screen, &state);
+    TEST_ASSERT_EQUAL(SCREEN_BRIGHTNESS_MAX, state.brightness[0]);
+
+    AdvanceSeconds(1);
+    ScreenGetState(screen, &state);
+    TEST_ASSERT_EQUAL(1, state.brightness[0]);
+
+    AppLimitBrightness(app, 0);
+    ScreenGetState(screen, &state);
+    TEST_ASSERT_EQUAL(0, state.brightness[0]);
+}
+
+// Una secuencia aleatoria de millones de eventos con tiempo simulado mantiene los invariantes de la interfaz.
+void test_random_events_keep_invariants(void) {
+    uint32_t seed = TEST_RANDOM_SEED;
+    uint32_t visited[APP_MODES] = {0};
+    uint32_t rings = 0;
+    uint8_t limit = SCREEN_BRIGHTNESS_MAX;
+    clockTimeT time;
+    screenStateT state;
+    clock_t start;
+    double elapsed;
+    char message[80];
+
+    for (uint16_t minutes = 0; minutes < TEST_VALID_FRAMES; minutes++) {
+        validFrames[minutes] = ScreenRenderBCD((minutes / 600) << 12 | (minutes / 60 % 10) << 8 |
+                                               (minutes % 60 / 10) << 4 | minutes % 10);
+    }
+    qsort(validFrames, TEST_VALID_FRAMES, sizeof(validFrames[0]), CompareFrames);
+
+    AppStart(app);
+    start = clock();
+    for (uint32_t event = 0; event < TEST_RANDOM_EVENTS; event++) {
+        // Generador xorshift, la secuencia depende solo de la semilla
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        if (seed % 64 == 0) {
+            AppKey(app, (seed >> 8) % APP_KEYS);
+        } else if (seed % 4096 == 1) {
+            limit = (seed >> 8) % (SCREEN_BRIGHTNESS_MAX + 1);
+            AppLimitBrightness(app, limit);
+        } else {
+            // Con el tick lento una interrupción cubre varios ticks del reloj
+            uint8_t ticks = seed % 16 == 2 ? 10 : 1;
+
+            now += ticks;
+            AppTick(app, ticks);
+            if (AppGetMode(app) <= APP_SHOW_TIME) {
+                TEST_ASSERT_EQUAL(ClockIsAlarmRinging(appClock), sounding);
+                TEST_ASSERT_EQUAL(ClockIsAlarmRinging(appClock), ringingLed);
+                TEST_ASSERT_EQUAL(ClockIsAlarmActive(appClock) && ClockIsAlarmEnabled(appClock),
+                                  (ShownFrame() & TEST_ALARM_DOT) != 0);
+            }
+            if (AppGetMode(app) == APP_SHOW_TIME) {
+                TEST_ASSERT_TRUE(ClockGetTime(appClock, &time));
+                TEST_ASSERT_EQUAL_HEX32(ScreenRenderBCD(time.bcd[5] << 12 | time.bcd[4] << 8 | time.bcd[3] << 4 |
+                                                        time.bcd[2]),
+                                        ShownFrame() & ~TEST_ALARM_DOT);
+            }
+        }
+
+        TEST_ASSERT_TRUE(AppGetMode(app) < APP_MODES);
+        TEST_ASSERT_TRUE(IsValidFrame(ShownFrame()));
+        ScreenGetState(screen, &state);
+        TEST_ASSERT_TRUE(state.brightness[0] <= limit);
+        visited[AppGetMode(app)]++;
+        rings += ClockIsAlarmRinging(appClock);
+    }
+    elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    for (uint8_t mode = 0; mode < APP_MODES; mode++) {
+        TEST_ASSERT_NOT_EQUAL(0, visited[mode]);
+    }
+    TEST_ASSERT_NOT_EQUAL(0, rings);
+
+    // El rendimiento depende de la computadora, se informa sin verificarlo
+    snprintf(message, sizeof(message), "%u eventos en %.3f s, %.0f eventos por segundo", TEST_RANDOM_EVENTS, elapsed,
+             elapsed > 0 ? TEST_RANDOM_EVENTS / elapsed : 0);
+    TEST_MESSAGE(message);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,113 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_calendar.c
+ ** @brief Archivo de pruebas unitarias para la conversión de fechas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "calendar.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_ASSERT_DATE(expectedYear, expectedMonth, expectedDay, date)                                             \
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(expectedYear, (date).year, "Diference in year");                                 \
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expectedMonth, (date).month, "Diference in month");                               \
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expectedDay, (date).day, "Diference in day")
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - El día cero corresponde al 1 de enero de 1970, jueves.
+ * - Convertir fechas a días y días a fechas en ambos sentidos.
+ * - Considerar los años bisiestos, incluyendo los múltiplos de 100 y de 400.
+ * - Rechazar fechas invalidas.
+ */
+
+void setUp(void) {
+}
+
+// El día cero corresponde al 1 de enero de 1970, jueves.
+void test_epoch_day(void) {
+    calendarDateT date;
+
+    CalendarFromDays(0, &date);
+    TEST_ASSERT_DATE(1970, 1, 1, date);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_THURSDAY, date.weekday);
+    TEST_ASSERT_EQUAL_UINT32(0, CalendarToDays(&date));
+}
+
+// Convertir una fecha conocida en ambos sentidos.
+void test_known_date(void) {
+    calendarDateT date = {.year = 2025, .month = 8, .day = 1};
+
+    TEST_ASSERT_EQUAL_UINT32(20301, CalendarToDays(&date));
+    CalendarFromDays(20301, &date);
+    TEST_ASSERT_DATE(2025, 8, 1, date);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_FRIDAY, date.weekday);
+}
+
+// Considerar los años bisiestos, incluyendo los múltiplos de 100 y de 400.
+void test_leap_years(void) {
+    calendarDateT date;
+
+    CalendarFromDays(CalendarToDays(&(calendarDateT){.year = 2000, .month = 2, .day = 28}) + 1, &date);
+    TEST_ASSERT_DATE(2000, 2, 29, date);
+    CalendarFromDays(CalendarToDays(&(calendarDateT){.year = 2100, .month = 2, .day = 28}) + 1, &date);
+    TEST_ASSERT_DATE(2100, 3, 1, date);
+    CalendarFromDays(CalendarToDays(&(calendarDateT){.year = 2024, .month = 12, .day = 31}) + 1, &date);
+    TEST_ASSERT_DATE(2025, 1, 1, date);
+}
+
+// Convertir todos los días de varios siglos en ambos sentidos.
+void test_round_trip(void) {
+    calendarDateT date;
+
+    for (uint32_t days = 0; days < 100000; days++) {
+        CalendarFromDays(days, &date);
+        TEST_ASSERT_TRUE(CalendarIsValid(&date));
+        TEST_ASSERT_EQUAL_UINT32(days, CalendarToDays(&date));
+    }
+}
+
+// Rechazar fechas invalidas.
+void test_invalid_dates(void) {
+    TEST_ASSERT_FALSE(CalendarIsValid(NULL));
+    TEST_ASSERT_FALSE(CalendarIsValid(&(calendarDateT){.year = 1969, .month = 12, .day = 31}));
+    TEST_ASSERT_FALSE(CalendarIsValid(&(calendarDateT){.year = 2025, .month = 13, .day = 1}));
+    TEST_ASSERT_FALSE(CalendarIsValid(&(calendarDateT){.year = 2025, .month = 4, .day = 31}));
+    TEST_ASSERT_FALSE(CalendarIsValid(&(calendarDateT){.year = 2100, .month = 2, .day = 29}));
+    TEST_ASSERT_TRUE(CalendarIsValid(&(calendarDateT){.year = 2024, .month = 2, .day = 29}));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -26,6 +26,8 @@ SPDX-License-Identifier: MIT
 
 #include "unity.h"
 #include "clock.h"
+#include "calendar.h"
+#include "timezone.h"
 #include <stdint.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -64,8 +66,17 @@ SPDX-License-Identifier: MIT
  */
 static void SimulateSeconds(clockT clock, uint32_t seconds);
 
+/**
+ * @brief Función de retorno que registra las veces que sonó la alarma.
+ *
+ * @param clock  Referencia al objeto reloj que disparó la alarma.
+ */
+static void AlarmRingingStub(clockT clock);
+
 /* === Private variable definitions ================================================================================ */
 
+static uint32_t alarmRingingCount;
+
 /* === Public variable definitions ================================================================================= */
 
 clockT clock;
@@ -79,6 +90,11 @@ static void SimulateSeconds(clockT clock, uint32_t seconds) {
     }
 }
 
+static void AlarmRingingStub(clockT clock) {
+    (void)clock;
+    alarmRingingCount++;
+}
+
 /* === Testing functions =========================================================================================== */
 
 /**
@@ -89,22 +105,30 @@ static void SimulateSeconds(clockT clock, uint32_t seconds) {
  * - Fijar la hora de la alarma y consultarla.
  * - Fijar la alarma y avanzar el reloj para que suene.
  * - Fijar la alarma, deshabilitarla y avanzar el reloj para no suene.
- * - Hacer sonar la alarma y posponerla.
+ * - Hacer sonar la alarma y posponerla sin modificar la hora configurada.
+ * - Posponer la alarma hasta alcanzar el límite de posposiciones.
  * - Hacer sonar la alarma y cancelarla hasta el otro dia.
  * - Probar getTime con NULL como argumento.
+ * - Fijar la fecha y avanzar el reloj para que cambie de día, de mes y de año.
+ * - Asignar una zona horaria y avanzar el reloj hasta el cambio de horario de verano.
  * - Hacer una prueba con frecuencias diferentes.
+ * - Usar una frecuencia de ticks fraccionaria y una corrección en partes por billón.
+ * - Guardar el estado del reloj y restaurarlo.
+ * - Restaurar la configuración al arrancar deja la hora guardada sin confirmar.
+ * - Ajustar el reloj a una hora UTC recibida de una referencia externa.
  *
  */
 
 void setUp(void) {
-    clock = ClockCreate(CLOCK_TICK_PER_SECONDS);
+    alarmRingingCount = 0;
+    clock = ClockCreate(CLOCK_TICK_PER_SECONDS, AlarmRingingStub);
 }
 
 // Al inicializar el reloj está en 00:00:00 y con hora invalida.
 void test_set_up_with_invalid_time(void) {
     clockTimeT currentTime = {.bcd = {1, 2, 3, 4, 5, 6}};
 
-    clockT localClock = ClockCreate(CLOCK_TICK_PER_SECONDS);
+    clockT localClock = ClockCreate(CLOCK_TICK_PER_SECONDS, AlarmRingingStub);
     TEST_ASSERT_FALSE(ClockGetTime(localClock, &currentTime));
     TEST_ASSERT_EACH_EQUAL_UINT8(0, currentTime.bcd, 6);
 }
@@ -172,6 +196,16 @@ void test_clock_advance_one_hour(void) {
     TEST_ASSERT_TIME(0, 1, 0, 0, 0, 0);
 }
 
+// Despues de n ciclos de reloj la hora avanza de las 03 a las 04
+void test_clock_advance_hour_units(void) {
+
+    ClockSetTime(clock, &(clockTimeT){.time = {
+                                          .hours = {3, 0}, .minutes = {9, 5}, .seconds = {9, 4} // 03:59:49
+                                      }});
+    SimulateSeconds(clock, 11);
+    TEST_ASSERT_TIME(0, 4, 0, 0, 0, 0);
+}
+
 // Despues de n ciclos de reloj la hora avanza diez horas
 void test_clock_advance_ten_hours(void) {
 
@@ -230,7 +264,7 @@ void test_clock_set_alarm_and_disable(void) {
     ClockSetAlarm(clock, &alarmTime);
     ClockAlarmAction(clock, ALARM_DISABLE); // Deshabilita la alarma
     SimulateSeconds(clock, 11);
-    TEST_ASSERT_FALSE(ClockAlarmRinging(clock)); // Verifica que la alarma no esté activa
+    TEST_ASSERT_FALSE(ClockIsAlarmRinging(clock)); // Verifica que la alarma no esté activa
 }
 
 // Probar getTime con NULL como argumento.
@@ -251,11 +285,14 @@ void test_clock_ring_and_postpone_alarm(void) {
 
     ClockSetAlarm(clock, &alarm);
     SimulateSeconds(clock, 60);
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock)); // Verifica que la alarma suene
-    ClockSnoozeAlarm(clock, 5);                 // Pospone la alarma por 5 minutos
-    TEST_ASSERT_ALARM(1, 0, 1, 5, 0, 0);        // Verifica que la alarma se haya pospuesto correctamente
-    SimulateSeconds(clock, 300);
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock)); // Verifica que la alarma suene
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock)); // Verifica que la alarma suene
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5)); // Pospone la alarma por 5 minutos
+    TEST_ASSERT_ALARM(1, 0, 1, 0, 0, 0);          // La hora configurada de la alarma no cambia
+    SimulateSeconds(clock, 299);
+    TEST_ASSERT_FALSE(ClockIsAlarmRinging(clock)); // Todavía no vence la posposición
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock)); // Verifica que la alarma suene
+    TEST_ASSERT_EQUAL_UINT8(1, ClockGetSnoozeCount(clock));
 }
 
 // Hacer sonar la alarma y cancelarla hasta el otro dia.
@@ -270,11 +307,11 @@ void test_clock_ring_and_cancel_alarm(void) {
 
     ClockSetAlarm(clock, &alarm);
     SimulateSeconds(clock, 60);
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock));  // Verifica que la alarma esté activa
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));  // Verifica que la alarma esté activa
     ClockAlarmAction(clock, ALARM_CANCEL);       // Cancela la alarma
-    TEST_ASSERT_FALSE(ClockAlarmRinging(clock)); // Verifica que la alarma no esté activa
+    TEST_ASSERT_FALSE(ClockIsAlarmRinging(clock)); // Verifica que la alarma no esté activa
     SimulateSeconds(clock, 86400);               // Avanza un día completo
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock));  // Verifica que la alarma está activa después de un día
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));  // Verifica que la alarma está activa después de un día
 }
 
 // Probar que la alarma se pospone correctamente al exceder el tiempo máximo permitido.
@@ -285,11 +322,56 @@ void test_alarm_snooze_overflow(void) {
     ClockSetAlarm(clock, &alarm);
 
     SimulateSeconds(clock, 60); // Avanza un minuto para activar la alarma
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock)); // Verifica que la alarma suene
-    ClockSnoozeAlarm(clock,70); // Debería quedar 00:05:00
-    SimulateSeconds(clock, 4200); // Avanza 5 minutos
-    TEST_ASSERT_TRUE(ClockAlarmRinging(clock)); // Verifica que la alarma suene nuevamente
-    TEST_ASSERT_ALARM(0, 1, 0, 0, 0, 0); // Verifica que la alarma se haya pospuesto correctamente
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock)); // Verifica que la alarma suene
+    ClockSnoozeAlarm(clock,70); // Debería sonar a las 01:00:00
+    SimulateSeconds(clock, 4200); // Avanza 70 minutos
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock)); // Verifica que la alarma suene nuevamente
+    TEST_ASSERT_ALARM(2, 3, 5, 0, 0, 0); // La hora configurada de la alarma no cambia
+}
+
+// Posponer la alarma y verificar que al otro día suena a la hora configurada.
+void test_alarm_snooze_keeps_next_day_alarm(void) {
+    static const clockTimeT alarm = {.time = {.hours = {7, 0}, .minutes = {0, 0}, .seconds = {0, 0}}}; // 07:00:00
+    clockStateT state;
+
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {6, 0}, .minutes = {9, 5}, .seconds = {0, 0}}}); // 06:59:00
+    ClockSetAlarm(clock, &alarm);
+
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 10));
+    TEST_ASSERT_TRUE(ClockGetState(clock, &state));
+    TEST_ASSERT_TRUE(state.flags & CLOCK_STATE_SNOOZED);
+    SimulateSeconds(clock, 600);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));
+    ClockAlarmAction(clock, ALARM_CANCEL);
+
+    SimulateSeconds(clock, 86400 - 600 - 1); // Un segundo antes de las 07:00:00 del día siguiente
+    TEST_ASSERT_FALSE(ClockIsAlarmRinging(clock));
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));
+    TEST_ASSERT_EQUAL_UINT8(0, ClockGetSnoozeCount(clock));
+    TEST_ASSERT_TRUE(ClockGetState(clock, &state));
+    TEST_ASSERT_FALSE(state.flags & CLOCK_STATE_SNOOZED);
+}
+
+// Posponer la alarma hasta alcanzar el límite de posposiciones.
+void test_alarm_snooze_limit(void) {
+    static const clockTimeT alarm = {.time = {.hours = {7, 0}, .minutes = {0, 0}, .seconds = {0, 0}}}; // 07:00:00
+
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {6, 0}, .minutes = {9, 5}, .seconds = {0, 0}}}); // 06:59:00
+    ClockSetAlarm(clock, &alarm);
+    ClockSetSnoozeLimit(clock, 2);
+
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 1));
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 1));
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));
+    TEST_ASSERT_FALSE(ClockSnoozeAlarm(clock, 1)); // Se alcanzó el límite, la alarma sigue sonando
+    TEST_ASSERT_TRUE(ClockIsAlarmRinging(clock));
+    TEST_ASSERT_EQUAL_UINT8(2, ClockGetSnoozeCount(clock));
+    TEST_ASSERT_EQUAL_UINT32(3, alarmRingingCount);
 }
 
 // Probar la protección contra NULL en las funciones de reloj.
@@ -303,4 +385,169 @@ void test_null_protection(void) {
 
 }
 
+// Fijar la fecha y consultarla.
+void test_clock_set_and_get_date(void) {
+    calendarDateT date = {0};
+
+    TEST_ASSERT_FALSE(ClockGetDate(clock, &date)); // La fecha no es válida al iniciar
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &(calendarDateT){.year = 2025, .month = 7, .day = 9}));
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(7, date.month);
+    TEST_ASSERT_EQUAL_UINT8(9, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_WEDNESDAY, date.weekday);
+}
+
+// Tratar de fijar una fecha invalida y verificar que la rechaza.
+void test_clock_set_invalid_date(void) {
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(calendarDateT){.year = 2025, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, NULL));
+}
+
+// Fijar la fecha y avanzar el reloj para que cambie de día, de mes y de año.
+void test_clock_advance_new_year(void) {
+    calendarDateT date = {0};
+
+    ClockSetDate(clock, &(calendarDateT){.year = 2024, .month = 12, .day = 31});
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {3, 2}, .minutes = {9, 5}, .seconds = {9, 5}}}); // 23:59:59
+    SimulateSeconds(clock, 1);
+
+    TEST_ASSERT_TIME(0, 0, 0, 0, 0, 0);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_WEDNESDAY, date.weekday);
+}
+
+// Asignar una zona horaria y verificar la hora base UTC.
+void test_clock_timezone_utc(void) {
+    ClockSetDate(clock, &(calendarDateT){.year = 2025, .month = 1, .day = 1});
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 0}}}); // 00:00:00
+    ClockSetTimezone(clock, TimezoneCreate("ART3"));
+
+    TEST_ASSERT_EQUAL_INT32(-3 * 3600, ClockGetUtcOffset(clock));
+    TEST_ASSERT_EQUAL_UINT32(1735700400, ClockGetUtc(clock)); // 2025-01-01 03:00:00 UTC
+    TEST_ASSERT_TIME(0, 0, 0, 0, 0, 0);
+}
+
+// Asignar una zona horaria y avanzar el reloj hasta el cambio de horario de verano.
+void test_clock_timezone_daylight_transition(void) {
+    calendarDateT date;
+
+    ClockSetTimezone(clock, TimezoneCreate("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ClockSetDate(clock, &(calendarDateT){.year = 2025, .month = 3, .day = 30});
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {1, 0}, .minutes = {9, 5}, .seconds = {9, 5}}}); // 01:59:59
+    TEST_ASSERT_EQUAL_INT32(3600, ClockGetUtcOffset(clock));
+
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_INT32(7200, ClockGetUtcOffset(clock));
+    TEST_ASSERT_TIME(0, 3, 0, 0, 0, 0);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(30, date.day);
+}
+
+// Usar una frecuencia de ticks fraccionaria sin acumular deriva.
+void test_clock_fractional_tick_rate(void) {
+    ClockSetTime(clock, &(clockTimeT){0});
+    TEST_ASSERT_TRUE(ClockSetTickRate(clock, 32768, 10000)); // 3,2768 ticks por segundo
+
+    for (uint32_t i = 0; i < 32767; i++) {
+        ClockNewTick(clock);
+    }
+    TEST_ASSERT_TIME(0, 2, 4, 6, 3, 9); // 9999 segundos
+    TEST_ASSERT_TRUE(ClockNewTick(clock));
+    TEST_ASSERT_EQUAL_UINT32(10000, ClockGetUtc(clock));
+}
+
+// Usar la frecuencia mas baja permitida y rechazar frecuencias menores.
+void test_clock_slow_tick_rate(void) {
+    ClockSetTime(clock, &(clockTimeT){0});
+    TEST_ASSERT_TRUE(ClockSetTickRate(clock, 1, 1));
+    TEST_ASSERT_TRUE(ClockNewTick(clock));
+    TEST_ASSERT_TRUE(ClockNewTick(clock));
+    TEST_ASSERT_FALSE(ClockSetTickRate(clock, 1, 2));
+    TEST_ASSERT_FALSE(ClockSetTickRate(clock, 1000, 0));
+}
+
+// Corregir la frecuencia en partes por billón para compensar el oscilador.
+void test_clock_trim(void) {
+    ClockSetTime(clock, &(clockTimeT){0});
+    TEST_ASSERT_TRUE(ClockSetTrim(clock, 1000000)); // 1000 ppm, el reloj adelanta un segundo cada 1000
+
+    SimulateSeconds(clock, 1000);
+    TEST_ASSERT_EQUAL_UINT32(1001, ClockGetUtc(clock));
+    TEST_ASSERT_TRUE(ClockSetTrim(clock, 0));
+    SimulateSeconds(clock, 1000);
+    TEST_ASSERT_EQUAL_UINT32(2001, ClockGetUtc(clock));
+}
+
+// Guardar el estado del reloj y restaurarlo.
+void test_clock_save_and_restore_state(void) {
+    static const clockTimeT alarm = {.time = {.hours = {7, 0}, .minutes = {0, 3}, .seconds = {0, 0}}}; // 07:30:00
+    clockStateT state;
+
+    ClockSetDate(clock, &(calendarDateT){.year = 2025, .month = 7, .day = 9});
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {4, 1}, .minutes = {0, 3}, .seconds = {5, 4}}}); // 14:30:45
+    ClockSetAlarm(clock, &alarm);
+    ClockAlarmAction(clock, ALARM_DISABLE);
+    ClockSetSnoozeLimit(clock, 5);
+    TEST_ASSERT_TRUE(ClockGetState(clock, &state));
+
+    clock = ClockCreate(CLOCK_TICK_PER_SECONDS, AlarmRingingStub);
+    TEST_ASSERT_TRUE(ClockSetState(clock, &state));
+    TEST_ASSERT_TIME(1, 4, 3, 0, 4, 5);
+    TEST_ASSERT_ALARM(0, 7, 3, 0, 0, 0);
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
+    TEST_ASSERT_EQUAL_UINT32(state.days, ClockGetDays(clock));
+}
+
+// Restaurar la configuración al arrancar deja la hora guardada sin confirmar.
+void test_clock_restore_settings(void) {
+    static const clockTimeT alarm = {.time = {.hours = {7, 0}, .minutes = {0, 3}, .seconds = {0, 0}}}; // 07:30:00
+    clockTimeT time;
+    clockStateT state;
+
+    ClockSetTime(clock, &(clockTimeT){.time = {.hours = {4, 1}, .minutes = {0, 3}, .seconds = {5, 4}}}); // 14:30:45
+    ClockSetAlarm(clock, &alarm);
+    ClockSetSnoozeLimit(clock, 5);
+    TEST_ASSERT_TRUE(ClockGetState(clock, &state));
+
+    clock = ClockCreate(CLOCK_TICK_PER_SECONDS, AlarmRingingStub);
+    TEST_ASSERT_TRUE(ClockRestoreSettings(clock, &state));
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &time));
+    TEST_ASSERT_EQUAL_UINT8(1, time.bcd[5]);
+    TEST_ASSERT_EQUAL_UINT8(4, time.bcd[4]);
+    TEST_ASSERT_EQUAL_UINT8(3, time.bcd[3]);
+    TEST_ASSERT_ALARM(0, 7, 3, 0, 0, 0);
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+    TEST_ASSERT_TRUE(ClockGetState(clock, &state));
+    TEST_ASSERT_EQUAL_UINT8(5, state.snoozeLimit);
+    TEST_ASSERT_FALSE(state.flags & CLOCK_STATE_VALID_TIME);
+    TEST_ASSERT_FALSE(ClockRestoreSettings(clock, NULL));
+}
+
+// Rechazar un estado corrupto.
+void test_clock_restore_invalid_state(void) {
+    clockStateT state = {.seconds = 86400, .flags = CLOCK_STATE_VALID_TIME};
+
+    TEST_ASSERT_FALSE(ClockSetState(clock, &state));
+    TEST_ASSERT_FALSE(ClockSetState(clock, NULL));
+}
+
+// Ajustar el reloj a una hora UTC y consultar la fracción de segundo.
+void test_clock_set_utc_and_fraction(void) {
+    calendarDateT date;
+
+    TEST_ASSERT_TRUE(ClockSetUtc(clock, 1742040000)); // 2025-03-15 12:00:00
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 0);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(15, date.day);
+    TEST_ASSERT_EQUAL_UINT32(0, ClockGetFraction(clock));
+
+    ClockNewTick(clock);
+    ClockNewTick(clock);
+    TEST_ASSERT_UINT32_WITHIN(1, 0x66666666, ClockGetFraction(clock)); // 0,4 segundos
+}
+
 /* === End of documentation ======================================================================================== */
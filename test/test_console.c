@@ -0,0 +1,412 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_console.c
+ ** @brief Archivo de pruebas unitarias para la consola de comandos por puerto serie.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "console.h"
+#include "console_pty.h"
+#include "clock.h"
+#include "calendar.h"
+#include "keylog.h"
+#include "power.h"
+#include "stack.h"
+#include "sync.h"
+#include "timezone.h"
+#include "trace.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CLOCK_TICK_PER_SECONDS 5
+#define TEST_BUFFER_SIZE       256
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint16_t FakeRead(uint8_t * data, uint16_t size);
+static uint16_t FakeWrite(const uint8_t * data, uint16_t size);
+static uint16_t FakeFree(void);
+static void ChangedStub(consoleT console);
+
+/**
+ * @brief Simula la recepción de un texto por el puerto serie y lo procesa.
+ *
+ * @param text  Texto recibido.
+ */
+static void Receive(const char * text);
+
+/**
+ * @brief Descarta lo transmitido por la consola hasta el momento.
+ */
+static void ClearOutput(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct consoleDriverS driver = {.Read = FakeRead, .Write = FakeWrite, .Free = FakeFree};
+
+static clockT clock;
+static consoleT console;
+static char input[TEST_BUFFER_SIZE];
+static uint16_t inputLength;
+static uint16_t inputPosition;
+static char output[TEST_BUFFER_SIZE];
+static uint16_t outputLength;
+static uint16_t outputSpace;
+static uint8_t changedCount;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t FakeRead(uint8_t * data, uint16_t size) {
+    uint16_t count = inputLength - inputPosition;
+
+    count = count < size ? count : size;
+    memcpy(data, &input[inputPosition], count);
+    inputPosition += count;
+    return count;
+}
+
+static uint16_t FakeWrite(const uint8_t * data, uint16_t size) {
+    uint16_t count = size < outputSpace ? size : outputSpace;
+
+    memcpy(&output[outputLength], data, count);
+    outputLength += count;
+    outputSpace -= count;
+    return count;
+}
+
+static uint16_t FakeFree(void) {
+    return outputSpace;
+}
+
+static void ChangedStub(consoleT console) {
+    (void)console;
+    changedCount++;
+}
+
+static void Receive(const char * text) {
+    inputLength = strlen(text);
+    inputPosition = 0;
+    memcpy(input, text, inputLength);
+    ConsolePoll(console);
+}
+
+static void ClearOutput(void) {
+    memset(output, 0, sizeof(output));
+    outputLength = 0;
+    outputSpace = sizeof(output) - 1;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Consultar la hora de un reloj sin configurar.
+ * - Configurar la hora y consultarla.
+ * - Una hora inválida o un comando desconocido responden con error.
+ * - Una línea más larga que el máximo se descarta completa y responde con error.
+ * - Un comando recibido en varias partes se ejecuta recién al completar la línea.
+ * - Configurar la fecha y consultarla.
+ * - Configurar la alarma, habilitarla y consultarla.
+ * - Un valor fuera de rango se rechaza sin modificar la hora, la fecha ni la alarma configuradas.
+ * - Configurar la zona horaria conserva la hora local y la zona se puede consultar.
+ * - Los cambios de estado se transmiten solo con el seguimiento habilitado.
+ * - Las respuestas que no entran en el buffer de transmisión se cuentan como descartadas.
+ * - Las estadísticas informan la permanencia en cada nivel de consumo si se asignó una política.
+ * - Las estadísticas informan el estado de la sincronización si se asignó una referencia.
+ * - El volcado del registro de eventos se transmite a medida que hay espacio.
+ * - El registro de teclas se vuelca, se reproduce y se descarta si se asignó a la consola.
+ * - La consola funciona sobre una pseudo-terminal.
+ */
+
+void setUp(void) {
+    clock = ClockCreate(CLOCK_TICK_PER_SECONDS, NULL);
+    console = ConsoleCreate(&driver, clock, ChangedStub);
+    ClearOutput();
+    changedCount = 0;
+}
+
+// Consultar la hora de un reloj sin configurar.
+void test_get_time_unconfigured(void) {
+    static const struct consoleDriverS incomplete = {.Read = FakeRead, .Write = FakeWrite};
+
+    TEST_ASSERT_NOT_NULL(console);
+    TEST_ASSERT_NULL(ConsoleCreate(&incomplete, clock, ChangedStub));
+    Receive("time\r");
+    TEST_ASSERT_EQUAL_STRING("time --:--:--\r\nok\r\n", output);
+}
+
+// Configurar la hora y consultarla.
+void test_set_and_get_time(void) {
+    Receive("time 14:30:45\r\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\n", output);
+    TEST_ASSERT_EQUAL_UINT8(1, changedCount);
+
+    ClearOutput();
+    Receive("time\n");
+    TEST_ASSERT_EQUAL_STRING("time 14:30:45\r\nok\r\n", output);
+
+    ClearOutput();
+    Receive("time 07:15\n");
+    Receive("time\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\ntime 07:15:00\r\nok\r\n", output);
+}
+
+// Una hora inválida o un comando desconocido responden con error.
+void test_invalid_commands(void) {
+    Receive("time 25:00\n");
+    Receive("time 1:00\n");
+    Receive("times\n");
+    Receive("watch maybe\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\nerror\r\nerror\r\nerror\r\n", output);
+    TEST_ASSERT_EQUAL_UINT8(0, changedCount);
+}
+
+// Una línea más larga que el máximo se descarta completa y responde con error.
+void test_line_overflow(void) {
+    Receive("time 12:00:00                                             time\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\n", output);
+    TEST_ASSERT_EQUAL_UINT8(0, changedCount);
+
+    ClearOutput();
+    Receive("time\n");
+    TEST_ASSERT_EQUAL_STRING("time --:--:--\r\nok\r\n", output);
+}
+
+// Un comando recibido en varias partes se ejecuta recién al completar la línea.
+void test_incremental_parsing(void) {
+    Receive("tim");
+    Receive("e 08:0");
+    TEST_ASSERT_EQUAL_UINT16(0, outputLength);
+    Receive("5\r");
+    TEST_ASSERT_EQUAL_STRING("ok\r\n", output);
+
+    ClearOutput();
+    Receive("tx\bime\n");
+    TEST_ASSERT_EQUAL_STRING("time 08:05:00\r\nok\r\n", output);
+}
+
+// Configurar la fecha y consultarla.
+void test_set_and_get_date(void) {
+    Receive("date 2025-02-29\n");
+    Receive("date\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\ndate ----------\r\nok\r\n", output);
+
+    ClearOutput();
+    Receive("date 2024-02-29\n");
+    Receive("date\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\ndate 2024-02-29\r\nok\r\n", output);
+    TEST_ASSERT_EQUAL_UINT8(1, changedCount);
+}
+
+// Configurar la alarma, habilitarla y consultarla.
+void test_set_and_enable_alarm(void) {
+    Receive("alarm on\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\n", output);
+
+    ClearOutput();
+    Receive("alarm 06:45\n");
+    Receive("alarm off\n");
+    Receive("alarm\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\nok\r\nalarm 06:45:00 off\r\nok\r\n", output);
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
+
+    ClearOutput();
+    Receive("alarm on\n");
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+    TEST_ASSERT_EQUAL_UINT8(3, changedCount);
+}
+
+// Un valor fuera de rango se rechaza sin modificar la hora, la fecha ni la alarma configuradas.
+void test_out_of_range_keeps_settings(void) {
+    Receive("time 14:30:45\n");
+    Receive("date 2024-05-10\n");
+    Receive("alarm 06:45\n");
+    Receive("alarm on\n");
+
+    ClearOutput();
+    Receive("time 25:00\n");
+    Receive("time 12:60\n");
+    Receive("date 2024-13-05\n");
+    Receive("alarm 27:00\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\nerror\r\nerror\r\nerror\r\n", output);
+    TEST_ASSERT_EQUAL_UINT8(4, changedCount);
+
+    ClearOutput();
+    Receive("time\n");
+    Receive("date\n");
+    Receive("alarm\n");
+    TEST_ASSERT_EQUAL_STRING("time 14:30:45\r\nok\r\ndate 2024-05-10\r\nok\r\nalarm 06:45:00 on\r\nok\r\n", output);
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+}
+
+// Configurar la zona horaria conserva la hora local y la zona se puede consultar.
+void test_set_and_get_zone(void) {
+    Receive("zone\n");
+    TEST_ASSERT_EQUAL_STRING("zone --\r\nok\r\n", output);
+
+    ClearOutput();
+    Receive("date 2025-01-15\n");
+    Receive("time 12:00\n");
+    Receive("zone AEST-10AEDT,M10.1.0,M4.1.0/3\n");
+    Receive("zone CET-1CEST,M3.5.0,M10.5.0/3\n");
+    Receive("zone CET-1CEST\n");
+    Receive("zone\n");
+    Receive("time\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\nok\r\nok\r\nok\r\nerror\r\nzone CET-1CEST,M3.5.0,M10.5.0/3\r\nok\r\n"
+                             "time 12:00:00\r\nok\r\n",
+                             output);
+    TEST_ASSERT_EQUAL_UINT8(4, changedCount);
+    TEST_ASSERT_EQUAL_INT32(3600, ClockGetUtcOffset(clock));
+}
+
+// Los cambios de estado se transmiten solo con el seguimiento habilitado.
+void test_watch_state_changes(void) {
+    ConsoleNotify(console, "mode show");
+    TEST_ASSERT_EQUAL_UINT16(0, outputLength);
+
+    Receive("watch on\n");
+    ConsoleNotify(console, "mode set");
+    Receive("watch off\n");
+    ConsoleNotify(console, "mode show");
+    TEST_ASSERT_EQUAL_STRING("ok\r\nevent mode set\r\nok\r\n", output);
+}
+
+// Las respuestas que no entran en el buffer de transmisión se cuentan como descartadas.
+void test_stats_counts_dropped_output(void) {
+    outputSpace = 4;
+    Receive("time\n");
+    TEST_ASSERT_EQUAL_STRING("time", output);
+
+    ClearOutput();
+    Receive("stats\n");
+    TEST_ASSERT_EQUAL_STRING("utc 0 offset 0\r\nringing no snoozes 0\r\ncommands 1 dropped 15\r\nok\r\n", output);
+}
+
+// Las estadísticas informan la permanencia en cada nivel de consumo si se asignó una política.
+void test_stats_reports_power_residency(void) {
+    static const uint32_t timeouts[POWER_LEVELS] = {[POWER_DIMMED] = 2000, [POWER_BLANK] = 5000};
+    powerT power = PowerCreate(timeouts, 0);
+
+    PowerPoll(power, 3000);
+    PowerPoll(power, 8500);
+    PowerPoll(power, 10500);
+    ConsoleSetPower(console, power);
+
+    ClearOutput();
+    Receive("stats\n");
+    TEST_ASSERT_EQUAL_STRING(
+        "utc 0 offset 0\r\nringing no snoozes 0\r\npower 3 5 2 0 changes 2\r\ncommands 0 dropped 0\r\nok\r\n", output);
+}
+
+// Las estadísticas informan el estado de la sincronización si se asignó una referencia.
+void test_stats_reports_sync(void) {
+    static const struct syncDriverS reference = {.Read = FakeRead};
+    static const char sentences[] = "$GNZDA,120000.00,15,03,2025,00,00*79\r\n$GNZDA,120000.00*00\r\n";
+    syncT sync = SyncCreate(&reference, clock);
+
+    // La referencia se lee del mismo buffer de entrada que la consola
+    inputLength = strlen(sentences);
+    inputPosition = 0;
+    memcpy(input, sentences, inputLength);
+    TEST_ASSERT_TRUE(SyncPoll(sync));
+    ConsoleSetSync(console, sync);
+
+    ClearOutput();
+    Receive("stats\n");
+    TEST_ASSERT_EQUAL_STRING("utc 1742040000 offset 0\r\nringing no snoozes 0\r\nsync offset 0 drift 0 trim 0\r\n"
+                             "sync samples 1 steps 1 errors 1\r\ncommands 0 dropped 0\r\nok\r\n",
+                             output);
+}
+
+// El volcado del registro de eventos se transmite a medida que hay espacio.
+void test_trace_dump(void) {
+    uint32_t now = 0x1234;
+
+    TraceInit(&now);
+    TraceRecord(TRACE_MODE, 1);
+    now++;
+    TraceRecord(TRACE_KEY, TRACE_KEY_ACCEPT);
+
+    Receive("trace\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\ntrace 00001234 00 0001\r\ntrace 00001235 01 0004\r\ntrace end\r\n", output);
+
+    ClearOutput();
+    outputSpace = 30;
+    Receive("trace\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\ntrace 00001234 00 0001\r\n", output);
+    outputSpace = 24;
+    ConsolePoll(console);
+    TEST_ASSERT_EQUAL_STRING("ok\r\ntrace 00001234 00 0001\r\ntrace 00001235 01 0004\r\n", output);
+}
+
+// El registro de teclas se vuelca, se reproduce y se descarta si se asignó a la consola.
+void test_keys_dump_and_play(void) {
+    keylogT keylog = KeylogCreate(16);
+    volatile uint32_t keys = 0;
+
+    Receive("keys\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\n", output);
+
+    KeylogCapture(keylog, 0, 1000);
+    KeylogCapture(keylog, 1 << 4, 1100);
+    KeylogCapture(keylog, 0, 1150);
+    ConsoleSetKeylog(console, keylog);
+    ClearOutput();
+    Receive("keys\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\nkeys C064 4032\r\nkeys end\r\n", output);
+
+    ClearOutput();
+    Receive("keys play 0\nkeys play 2\n");
+    TEST_ASSERT_EQUAL_STRING("error\r\nok\r\n", output);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 0, &keys));
+
+    ClearOutput();
+    Receive("keys stop\nkeys clear\nkeys\n");
+    TEST_ASSERT_EQUAL_STRING("ok\r\nok\r\nok\r\nkeys end\r\n", output);
+    TEST_ASSERT_FALSE(KeylogReplayPoll(keylog, 0, &keys));
+}
+
+// La consola funciona sobre una pseudo-terminal.
+void test_console_over_pty(void) {
+    char received[TEST_BUFFER_SIZE] = {0};
+    uint16_t length = 0;
+
+    console = ConsoleCreate(ConsolePtyCreate(), clock, ChangedStub);
+    TEST_ASSERT_NOT_NULL(console);
+    TEST_ASSERT_NOT_NULL(ConsolePtyName());
+
+    ConsolePtyType("time 10:20:30\rtime\r", 19);
+    ConsolePoll(console);
+    for (int retry = 0; retry < 1000 && length < 25; retry++) {
+        length += ConsolePtyReceive(&received[length], sizeof(received) - length - 1);
+    }
+    ConsolePtyClose();
+    TEST_ASSERT_EQUAL_STRING("ok\r\ntime 10:20:30\r\nok\r\n", received);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,281 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_coproc.c
+ ** @brief Archivo de pruebas unitarias para el barrido del display y el filtrado de teclas en el núcleo secundario.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "coproc.h"
+#include "core_thread.h"
+#include "mailbox.h"
+#include "screen.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_DIGITS 4
+
+//! Imagen del número 1
+#define IMAGE_ONE (SEGMENT_B | SEGMENT_C)
+//! Imagen del número 2
+#define IMAGE_TWO (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+
+#define TEST_REFRESHES (2 * TEST_DIGITS * SCREEN_BRIGHTNESS_BITS) //!< Refrescos de dos cuadros completos
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdates(uint8_t value);
+static void FakeDigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Refresca un cuadro completo del núcleo secundario y registra la imagen mostrada en cada dígito.
+ *
+ * @param images  Arreglo donde se guardan las imágenes de los dígitos.
+ */
+static void ShownImages(uint8_t images[TEST_DIGITS]);
+
+/**
+ * @brief Lazo del hilo que reemplaza al núcleo secundario, barre la pantalla sin detenerse.
+ *
+ * @param context   No se usa.
+ */
+static void Core(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screenDriverS driver = {
+    .DigitsTurnOff = FakeDigitsTurnOff, .SegmentsUpdates = FakeSegmentsUpdates, .DigitTurnOn = FakeDigitTurnOn};
+
+static struct mailboxS mailbox;
+static screenT model;
+static screenStateT published;
+static screenT screen;
+static coprocT coproc;
+static uint8_t segments;
+static int8_t digitOn;
+static uint8_t shown[TEST_DIGITS]; //!< Última imagen mostrada en cada dígito
+static uint32_t refreshes;         //!< Refrescos hechos por el hilo
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+    digitOn = -1;
+}
+
+static void FakeSegmentsUpdates(uint8_t value) {
+    segments = value;
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    digitOn = digit;
+    shown[digit] = segments;
+}
+
+static void ShownImages(uint8_t images[TEST_DIGITS]) {
+    memset(shown, 0, sizeof(shown));
+    for (uint8_t refresh = 0; refresh < TEST_DIGITS * SCREEN_BRIGHTNESS_BITS; refresh++) {
+        CoprocRefresh(coproc);
+    }
+    memcpy(images, shown, sizeof(shown));
+}
+
+static void Core(void * context) {
+    (void)context;
+    while (CoreThreadRunning()) {
+        CoprocRefresh(coproc);
+        __atomic_add_fetch(&refreshes, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - El núcleo secundario muestra el estado publicado por el principal.
+ * - Un estado sin cambios no se vuelve a publicar.
+ * - Publicar otros cambios no reinicia el parpadeo en curso.
+ * - Una tecla cambia solo después de mantenerse estable.
+ * - Las teclas se filtran en forma independiente.
+ * - Un hilo que reemplaza al núcleo secundario muestra el estado publicado mientras barre.
+ * - Un programa con la pila en la RAM y el reset en la flash es válido.
+ * - La flash borrada no es un programa válido.
+ * - Un reset sin el bit de Thumb o fuera del programa no es válido.
+ * - El encendido se reparte en los intervalos del brillo y el de mayor peso se prolonga con el tiempo apagado.
+ * - Un tiempo apagado de un microsegundo se descarta para que las dos comparaciones no coincidan.
+ */
+
+void setUp(void) {
+    MailboxInit(&mailbox, SCREEN_FRAME_RATE, 1000);
+    memset(&published, 0, sizeof(published));
+    model = ScreenCreate(TEST_DIGITS, &driver);
+    screen = ScreenCreate(TEST_DIGITS, &driver);
+    coproc = CoprocCreate(&mailbox, screen);
+}
+
+// El núcleo secundario muestra el estado publicado por el principal.
+void test_publish_state(void) {
+    uint8_t images[TEST_DIGITS];
+
+    ScreenWriteFrame(model, ScreenRenderBCD(0x1212));
+    ScreenSetDots(model, 1 << 1);
+    TEST_ASSERT_TRUE(CoprocPublish(&mailbox, model, &published));
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO | SEGMENT_DP, images[1]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, images[3]);
+}
+
+// Un estado sin cambios no se vuelve a publicar.
+void test_publish_only_changes(void) {
+    uint32_t sequence;
+
+    TEST_ASSERT_TRUE(CoprocPublish(&mailbox, model, &published));
+    sequence = mailbox.sequence;
+    TEST_ASSERT_FALSE(CoprocPublish(&mailbox, model, &published));
+    TEST_ASSERT_EQUAL_UINT32(sequence, mailbox.sequence);
+}
+
+// Publicar otros cambios no reinicia el parpadeo en curso.
+void test_publish_keeps_flash_phase(void) {
+    uint8_t images[TEST_DIGITS];
+
+    ScreenWriteFrame(model, ScreenRenderBCD(0x1111));
+    ScreenFlashDigits(model, 0, 0, 2);
+    CoprocPublish(&mailbox, model, &published);
+    ShownImages(images);
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[0]); // Segundo cuadro, comienza la fase encendida
+
+    ScreenWriteFrame(model, ScreenRenderBCD(0x1211));
+    CoprocPublish(&mailbox, model, &published);
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[0]); // Si el ciclo se reiniciara volvería a la fase apagada
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, images[1]);
+}
+
+// Una tecla cambia solo después de mantenerse estable.
+void test_key_debounce(void) {
+    for (uint8_t sample = 1; sample < COPROC_DEBOUNCE; sample++) {
+        TEST_ASSERT_FALSE(CoprocSampleKeys(coproc, 1 << 2));
+    }
+    TEST_ASSERT_FALSE(CoprocSampleKeys(coproc, 0)); // Un rebote reinicia la cuenta
+    for (uint8_t sample = 1; sample < COPROC_DEBOUNCE; sample++) {
+        TEST_ASSERT_FALSE(CoprocSampleKeys(coproc, 1 << 2));
+    }
+    TEST_ASSERT_EQUAL_HEX32(0, mailbox.keys);
+    TEST_ASSERT_TRUE(CoprocSampleKeys(coproc, 1 << 2));
+    TEST_ASSERT_EQUAL_HEX32(1 << 2, mailbox.keys);
+}
+
+// Las teclas se filtran en forma independiente.
+void test_keys_independent(void) {
+    for (uint8_t sample = 0; sample < COPROC_DEBOUNCE; sample++) {
+        CoprocSampleKeys(coproc, (sample & 1) ? 1 << 0 | 1 << 1 : 1 << 1);
+    }
+    TEST_ASSERT_EQUAL_HEX32(1 << 1, mailbox.keys);
+}
+
+// Un hilo que reemplaza al núcleo secundario muestra el estado publicado mientras barre.
+void test_thread_stands_in_for_core(void) {
+    uint32_t start;
+
+    TEST_ASSERT_TRUE(CoreThreadStart(Core, NULL));
+    ScreenWriteFrame(model, ScreenRenderBCD(0x2121));
+    CoprocPublish(&mailbox, model, &published);
+    start = __atomic_load_n(&refreshes, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&refreshes, __ATOMIC_SEQ_CST) - start < TEST_REFRESHES) {
+    }
+    CoreThreadStop();
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, shown[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, shown[1]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, shown[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, shown[3]);
+}
+
+// Un programa con la pila en la RAM y el reset en la flash es válido.
+void test_image_valid(void) {
+    const uint32_t linked[] = {0x10092000, COPROC_IMAGE_ADDRESS + 0x0101};
+    const uint32_t shadow[] = {0x20010000, 0x0101};
+
+    TEST_ASSERT_TRUE(CoprocImageValid(linked));
+    TEST_ASSERT_TRUE(CoprocImageValid(shadow));
+}
+
+// La flash borrada no es un programa válido.
+void test_image_erased(void) {
+    const uint32_t erased[] = {0xFFFFFFFF, 0xFFFFFFFF};
+
+    TEST_ASSERT_FALSE(CoprocImageValid(erased));
+    TEST_ASSERT_FALSE(CoprocImageValid(NULL));
+}
+
+// Un reset sin el bit de Thumb o fuera del programa no es válido.
+void test_image_bad_reset(void) {
+    const uint32_t arm[] = {0x10092000, COPROC_IMAGE_ADDRESS + 0x0100};
+    const uint32_t outside[] = {0x10092000, COPROC_IMAGE_ADDRESS + COPROC_IMAGE_SIZE + 1};
+
+    TEST_ASSERT_FALSE(CoprocImageValid(arm));
+    TEST_ASSERT_FALSE(CoprocImageValid(outside));
+}
+
+// El encendido se reparte en los intervalos del brillo y el de mayor peso se prolonga con el tiempo apagado.
+void test_scan_schedule(void) {
+    const uint8_t last = (SCREEN_BRIGHTNESS_MAX + 1) / 2;
+    coprocScanT scan;
+    uint32_t blank;
+
+    TEST_ASSERT_TRUE(CoprocScanTiming(&scan, 250, 2000, 4)); // Turnos de 1000 us, el encendido se limita al turno
+    TEST_ASSERT_EQUAL_UINT32(1000 / SCREEN_BRIGHTNESS_MAX, scan.unit);
+    TEST_ASSERT_EQUAL_UINT32(1000 - scan.unit * SCREEN_BRIGHTNESS_MAX, scan.gap);
+
+    TEST_ASSERT_EQUAL_UINT32(scan.unit - 1, CoprocScanSchedule(&scan, 1, &blank));
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, blank);
+    TEST_ASSERT_EQUAL_UINT32(last * scan.unit + scan.gap - 1, CoprocScanSchedule(&scan, last, &blank));
+    TEST_ASSERT_EQUAL_UINT32(last * scan.unit, blank);
+
+    TEST_ASSERT_FALSE(CoprocScanTiming(&scan, 0, 900, 4));
+    TEST_ASSERT_FALSE(CoprocScanTiming(&scan, 250, SCREEN_BRIGHTNESS_MAX - 1, 4));
+}
+
+// Un tiempo apagado de un microsegundo se descarta para que las dos comparaciones no coincidan.
+void test_scan_drops_short_gap(void) {
+    const uint8_t last = (SCREEN_BRIGHTNESS_MAX + 1) / 2;
+    coprocScanT scan;
+    uint32_t blank;
+
+    // Turnos de 1002 us con 1001 us de encendido, que con el brillo de tres bits deja un microsegundo apagado
+    TEST_ASSERT_TRUE(CoprocScanTiming(&scan, 998, 1001, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, scan.gap);
+    TEST_ASSERT_EQUAL_UINT32(last * scan.unit - 1, CoprocScanSchedule(&scan, last, &blank));
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, blank);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,247 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digital.c
+ ** @brief Pruebas unitarias de las salidas digitales y del PWM por software.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "chip.h"
+#include "digital.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_PORT   1    //!< Puerto de las salidas de prueba
+#define TEST_PERIOD 1020 //!< Período del PWM, cuatro ticks por paso del ciclo de trabajo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Indica si una salida de prueba está en alto.
+ *
+ * @param pin  Pin de la salida.
+ * @return true Si el pin está en alto.
+ */
+static bool PinHigh(uint8_t pin);
+
+/* === Private variable definitions ================================================================================ */
+
+static digitalOutputT outputs[DIGITAL_PWM_CHANNELS + 1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool PinHigh(uint8_t pin) {
+    return (LPC_GPIO_PORT->PIN[TEST_PORT] >> pin) & 1;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Activar y desactivar una salida respeta su nivel inactivo.
+ * - Un grupo solo puede tener salidas de un mismo puerto.
+ * - Un grupo cambia todas sus salidas con una única escritura sin modificar los demás pines.
+ * - Un grupo respeta el nivel inactivo de cada salida.
+ * - El valor de un grupo se puede calcular una vez y escribir luego.
+ * - El período debe alcanzar para un tick por paso del ciclo de trabajo.
+ * - Sin ciclos de trabajo intermedios hay una sola interrupción por período.
+ * - Una salida genera un flanco al comenzar el período y otro al cumplir su ciclo de trabajo.
+ * - Las salidas con el mismo ciclo de trabajo comparten el flanco.
+ * - Los flancos se ordenan por tiempo sin importar el orden de configuración.
+ * - Un cambio del ciclo de trabajo se aplica al comenzar el período siguiente.
+ * - Los ciclos de trabajo extremos dejan la salida fija.
+ * - La cantidad de canales es limitada.
+ * - Una entrada se puede leer de un bit de una palabra en memoria.
+ */
+
+void setUp(void) {
+    HostGpioReset();
+    for (uint8_t pin = 0; pin <= DIGITAL_PWM_CHANNELS; pin++) {
+        outputs[pin] = DigitalOutputCreate(TEST_PORT, pin, false);
+    }
+    DigitalPwmInit(TEST_PERIOD);
+}
+
+// Activar y desactivar una salida respeta su nivel inactivo.
+void test_output_levels(void) {
+    digitalOutputT inverted = DigitalOutputCreate(TEST_PORT, 20, true);
+
+    TEST_ASSERT_TRUE(PinHigh(20));
+    DigitalOutputActivate(inverted);
+    TEST_ASSERT_FALSE(PinHigh(20));
+    DigitalOutputActivate(outputs[0]);
+    TEST_ASSERT_TRUE(PinHigh(0));
+    DigitalOutputDesactivate(outputs[0]);
+    TEST_ASSERT_FALSE(PinHigh(0));
+}
+
+// Un grupo solo puede tener salidas de un mismo puerto.
+void test_group_single_port(void) {
+    digitalOutputT mixed[] = {outputs[0], DigitalOutputCreate(TEST_PORT + 1, 0, false)};
+
+    TEST_ASSERT_NULL(DigitalOutputGroupCreate(mixed, 2));
+    TEST_ASSERT_NULL(DigitalOutputGroupCreate(outputs, 0));
+    TEST_ASSERT_NOT_NULL(DigitalOutputGroupCreate(outputs, 3));
+}
+
+// Un grupo cambia todas sus salidas con una única escritura sin modificar los demás pines.
+void test_group_single_write(void) {
+    digitalOutputT members[] = {outputs[1], outputs[3], outputs[5]};
+    digitalOutputGroupT group = DigitalOutputGroupCreate(members, 3);
+    uint32_t writes;
+
+    DigitalOutputActivate(outputs[0]);
+    DigitalOutputActivate(outputs[3]);
+    writes = HostGpioWrites();
+    DigitalOutputGroupSet(group, 0x5);
+    TEST_ASSERT_EQUAL_UINT32(writes + 1, HostGpioWrites());
+    TEST_ASSERT_TRUE(PinHigh(1));
+    TEST_ASSERT_FALSE(PinHigh(3));
+    TEST_ASSERT_TRUE(PinHigh(5));
+    TEST_ASSERT_TRUE(PinHigh(0));
+    TEST_ASSERT_FALSE(PinHigh(2));
+}
+
+// Un grupo respeta el nivel inactivo de cada salida.
+void test_group_inverted_outputs(void) {
+    digitalOutputT members[] = {DigitalOutputCreate(TEST_PORT, 20, true), outputs[0]};
+    digitalOutputGroupT group = DigitalOutputGroupCreate(members, 2);
+
+    DigitalOutputGroupSet(group, 0x3);
+    TEST_ASSERT_FALSE(PinHigh(20));
+    TEST_ASSERT_TRUE(PinHigh(0));
+    DigitalOutputGroupSet(group, 0x0);
+    TEST_ASSERT_TRUE(PinHigh(20));
+    TEST_ASSERT_FALSE(PinHigh(0));
+}
+
+// El valor de un grupo se puede calcular una vez y escribir luego.
+void test_group_cached_pattern(void) {
+    digitalOutputGroupT group = DigitalOutputGroupCreate(outputs, 2);
+    uint32_t both = DigitalOutputGroupPattern(group, 0x3);
+
+    TEST_ASSERT_EQUAL_HEX32(0x3, both);
+    DigitalOutputGroupWrite(group, both);
+    TEST_ASSERT_TRUE(PinHigh(0));
+    TEST_ASSERT_TRUE(PinHigh(1));
+}
+
+// El período debe alcanzar para un tick por paso del ciclo de trabajo.
+void test_period_limit(void) {
+    TEST_ASSERT_FALSE(DigitalPwmInit(DIGITAL_PWM_MAX - 1));
+    TEST_ASSERT_TRUE(DigitalPwmInit(DIGITAL_PWM_MAX));
+}
+
+// Sin ciclos de trabajo intermedios hay una sola interrupción por período.
+void test_idle_single_interrupt(void) {
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD, DigitalPwmUpdate());
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD, DigitalPwmUpdate());
+}
+
+// Una salida genera un flanco al comenzar el período y otro al cumplir su ciclo de trabajo.
+void test_single_output_edges(void) {
+    DigitalOutputSetDuty(outputs[0], 51);
+    TEST_ASSERT_EQUAL_UINT32(204, DigitalPwmUpdate());
+    TEST_ASSERT_TRUE(PinHigh(0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD - 204, DigitalPwmUpdate());
+    TEST_ASSERT_FALSE(PinHigh(0));
+    TEST_ASSERT_EQUAL_UINT32(204, DigitalPwmUpdate());
+    TEST_ASSERT_TRUE(PinHigh(0));
+}
+
+// Las salidas con el mismo ciclo de trabajo comparten el flanco.
+void test_shared_edge(void) {
+    DigitalOutputSetDuty(outputs[0], 100);
+    DigitalOutputSetDuty(outputs[1], 100);
+    TEST_ASSERT_EQUAL_UINT32(400, DigitalPwmUpdate());
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD - 400, DigitalPwmUpdate());
+    TEST_ASSERT_FALSE(PinHigh(0));
+    TEST_ASSERT_FALSE(PinHigh(1));
+}
+
+// Los flancos se ordenan por tiempo sin importar el orden de configuración.
+void test_edges_sorted(void) {
+    DigitalOutputSetDuty(outputs[0], 200);
+    DigitalOutputSetDuty(outputs[1], 50);
+    DigitalOutputSetDuty(outputs[2], 100);
+
+    TEST_ASSERT_EQUAL_UINT32(200, DigitalPwmUpdate());
+    TEST_ASSERT_EQUAL_UINT32(200, DigitalPwmUpdate());
+    TEST_ASSERT_FALSE(PinHigh(1));
+    TEST_ASSERT_TRUE(PinHigh(2));
+    TEST_ASSERT_EQUAL_UINT32(400, DigitalPwmUpdate());
+    TEST_ASSERT_FALSE(PinHigh(2));
+    TEST_ASSERT_TRUE(PinHigh(0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD - 800, DigitalPwmUpdate());
+    TEST_ASSERT_FALSE(PinHigh(0));
+}
+
+// Un cambio del ciclo de trabajo se aplica al comenzar el período siguiente.
+void test_duty_change_at_period_start(void) {
+    DigitalOutputSetDuty(outputs[0], 100);
+    DigitalPwmUpdate();
+    DigitalOutputSetDuty(outputs[0], 200);
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD - 400, DigitalPwmUpdate());
+    TEST_ASSERT_EQUAL_UINT32(800, DigitalPwmUpdate());
+}
+
+// Los ciclos de trabajo extremos dejan la salida fija.
+void test_extreme_duties(void) {
+    DigitalOutputSetDuty(outputs[0], DIGITAL_PWM_MAX);
+    DigitalOutputSetDuty(outputs[1], 0);
+    DigitalOutputActivate(outputs[1]);
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD, DigitalPwmUpdate());
+    TEST_ASSERT_TRUE(PinHigh(0));
+    TEST_ASSERT_FALSE(PinHigh(1));
+
+    DigitalOutputSetDuty(outputs[0], 0);
+    DigitalPwmUpdate();
+    TEST_ASSERT_FALSE(PinHigh(0));
+}
+
+// La cantidad de canales es limitada.
+void test_channel_limit(void) {
+    for (uint8_t pin = 0; pin < DIGITAL_PWM_CHANNELS; pin++) {
+        TEST_ASSERT_TRUE(DigitalOutputSetDuty(outputs[pin], pin + 1));
+    }
+    TEST_ASSERT_FALSE(DigitalOutputSetDuty(outputs[DIGITAL_PWM_CHANNELS], 1));
+    TEST_ASSERT_TRUE(DigitalOutputSetDuty(outputs[0], 10));
+}
+
+// Una entrada se puede leer de un bit de una palabra en memoria.
+void test_input_from_word(void) {
+    volatile uint32_t keys = 0;
+    digitalInputT input = DigitalInputCreateWord(&keys, 3, false);
+
+    TEST_ASSERT_NULL(DigitalInputCreateWord(&keys, 32, false));
+    TEST_ASSERT_FALSE(DigitalInputGetActivate(input));
+    keys = 1 << 3;
+    TEST_ASSERT_TRUE(DigitalInputWasActivated(input));
+    keys = 0;
+    TEST_ASSERT_TRUE(DigitalInputWasDeactivated(input));
+}
+
+/* === End of documentation ======================================================================================== */
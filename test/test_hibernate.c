@@ -0,0 +1,211 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_hibernate.c
+ ** @brief Archivo de pruebas unitarias para la conservación del estado del reloj durante el apagado profundo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "hibernate.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_WORDS 16 //!< Palabras retenidas del driver simulado
+
+#define TEST_SECONDS(hours, minutes, seconds) ((hours) * 3600UL + (minutes) * 60UL + (seconds))
+
+#define TEST_MODE 1 //!< Modo de la interfaz que se guarda
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint32_t FakeRead(uint8_t index);
+static void FakeWrite(uint8_t index, uint32_t value);
+static uint32_t FakeElapsed(void);
+static void FakePowerDown(uint32_t wake);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct hibernateDriverS driver = {
+    .words = TEST_WORDS, .Read = FakeRead, .Write = FakeWrite, .Elapsed = FakeElapsed, .PowerDown = FakePowerDown};
+
+static const struct hibernateDriverS small = {
+    .words = 4, .Read = FakeRead, .Write = FakeWrite, .Elapsed = FakeElapsed, .PowerDown = FakePowerDown};
+
+static uint32_t retained[TEST_WORDS];
+static uint32_t elapsed;
+static uint32_t wakeAfter;
+static int powerDowns;
+
+static clockStateT state;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t FakeRead(uint8_t index) {
+    return retained[index];
+}
+
+static void FakeWrite(uint8_t index, uint32_t value) {
+    retained[index] = value;
+}
+
+static uint32_t FakeElapsed(void) {
+    return elapsed;
+}
+
+static void FakePowerDown(uint32_t wake) {
+    wakeAfter = wake;
+    powerDowns++;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Un arranque normal no encuentra un estado guardado.
+ * - El estado y el modo guardados se recuperan sin cambios si no pasó el tiempo.
+ * - El tiempo apagado adelanta la hora, pasando a los días siguientes.
+ * - El estado se recupera una sola vez.
+ * - Un estado guardado alterado se descarta.
+ * - Con la alarma habilitada el despertador se programa antes de que suene.
+ * - No se hiberna si la alarma suena antes de que el reloj pueda volver a funcionar.
+ * - No se hiberna si el driver no tiene palabras suficientes.
+ * - No se hiberna con una posposición pendiente, que no se podría restaurar al despertar.
+ */
+
+void setUp(void) {
+    memset(retained, 0, sizeof(retained));
+    elapsed = 0;
+    wakeAfter = UINT32_MAX;
+    powerDowns = 0;
+
+    memset(&state, 0, sizeof(state));
+    state.days = 20000;
+    state.seconds = TEST_SECONDS(12, 34, 56);
+    state.alarmSeconds = TEST_SECONDS(6, 30, 0);
+    state.trim = -1500;
+    state.snoozeLimit = 3;
+    state.flags = CLOCK_STATE_VALID_TIME | CLOCK_STATE_VALID_DATE | CLOCK_STATE_VALID_ALARM;
+}
+
+// Un arranque normal no encuentra un estado guardado.
+void test_cold_boot_has_no_state(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    TEST_ASSERT_FALSE(HibernateRestore(&driver, &restored, &mode));
+    TEST_ASSERT_FALSE(HibernateRestore(NULL, &restored, &mode));
+}
+
+// El estado y el modo guardados se recuperan sin cambios si no pasó el tiempo.
+void test_restore_saved_state(void) {
+    clockStateT restored;
+    uint8_t mode = 0;
+
+    TEST_ASSERT_TRUE(HibernateEnter(&driver, &state, TEST_MODE));
+    TEST_ASSERT_EQUAL(1, powerDowns);
+    TEST_ASSERT_EQUAL_UINT32(0, wakeAfter);
+
+    TEST_ASSERT_TRUE(HibernateRestore(&driver, &restored, &mode));
+    TEST_ASSERT_EQUAL_MEMORY(&state, &restored, sizeof(clockStateT));
+    TEST_ASSERT_EQUAL_UINT8(TEST_MODE, mode);
+}
+
+// El tiempo apagado adelanta la hora, pasando a los días siguientes.
+void test_elapsed_time_advances_clock(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    TEST_ASSERT_TRUE(HibernateEnter(&driver, &state, TEST_MODE));
+    elapsed = 2 * 86400UL + TEST_SECONDS(12, 0, 0);
+
+    TEST_ASSERT_TRUE(HibernateRestore(&driver, &restored, &mode));
+    TEST_ASSERT_EQUAL_UINT32(20003, restored.days);
+    TEST_ASSERT_EQUAL_UINT32(TEST_SECONDS(0, 34, 56), restored.seconds);
+    TEST_ASSERT_EQUAL_UINT32(state.alarmSeconds, restored.alarmSeconds);
+}
+
+// El estado se recupera una sola vez.
+void test_restore_only_once(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    TEST_ASSERT_TRUE(HibernateEnter(&driver, &state, TEST_MODE));
+    TEST_ASSERT_TRUE(HibernateRestore(&driver, &restored, &mode));
+    TEST_ASSERT_FALSE(HibernateRestore(&driver, &restored, &mode));
+}
+
+// Un estado guardado alterado se descarta.
+void test_corrupted_state(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    TEST_ASSERT_TRUE(HibernateEnter(&driver, &state, TEST_MODE));
+    retained[2] ^= 0x100;
+    TEST_ASSERT_FALSE(HibernateRestore(&driver, &restored, &mode));
+}
+
+// Con la alarma habilitada el despertador se programa antes de que suene.
+void test_wake_before_alarm(void) {
+    state.flags |= CLOCK_STATE_ALARM_ENABLED;
+
+    TEST_ASSERT_TRUE(HibernateEnter(&driver, &state, TEST_MODE));
+    TEST_ASSERT_EQUAL_UINT32(TEST_SECONDS(17, 55, 4) - HIBERNATE_WAKE_MARGIN, wakeAfter);
+}
+
+// No se hiberna si la alarma suena antes de que el reloj pueda volver a funcionar.
+void test_alarm_too_close(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    state.flags |= CLOCK_STATE_ALARM_ENABLED;
+    state.alarmSeconds = state.seconds + HIBERNATE_WAKE_MARGIN;
+
+    TEST_ASSERT_FALSE(HibernateEnter(&driver, &state, TEST_MODE));
+    TEST_ASSERT_EQUAL(0, powerDowns);
+    TEST_ASSERT_FALSE(HibernateRestore(&driver, &restored, &mode));
+}
+
+// No se hiberna si el driver no tiene palabras suficientes.
+void test_driver_too_small(void) {
+    TEST_ASSERT_FALSE(HibernateEnter(&small, &state, TEST_MODE));
+    TEST_ASSERT_FALSE(HibernateEnter(&driver, NULL, TEST_MODE));
+    TEST_ASSERT_EQUAL(0, powerDowns);
+}
+
+// No se hiberna con una posposición pendiente, que no se podría restaurar al despertar.
+void test_snooze_pending(void) {
+    clockStateT restored;
+    uint8_t mode;
+
+    state.flags |= CLOCK_STATE_ALARM_ENABLED | CLOCK_STATE_SNOOZED;
+
+    TEST_ASSERT_FALSE(HibernateEnter(&driver, &state, TEST_MODE));
+    TEST_ASSERT_EQUAL(0, powerDowns);
+    TEST_ASSERT_FALSE(HibernateRestore(&driver, &restored, &mode));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,372 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_keylog.c
+ ** @brief Archivo de pruebas unitarias para la captura y reproducción de los cambios de las teclas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "keylog.h"
+#include "app.h"
+#include "calendar.h"
+#include "clock.h"
+#include "digital.h"
+#include "screen.h"
+#include "timezone.h"
+#include "trace.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_CAPACITY 8 //!< Entradas de los registros de prueba
+
+#define PRESS(key, delta)   (0x8000 | (key) << 12 | (delta)) //!< Entrada de una tecla presionada
+#define RELEASE(key, delta) ((key) << 12 | (delta))          //!< Entrada de una tecla soltada
+#define PAUSE(units)        (0x7000 | (units))               //!< Entrada de pausa, en unidades de 4096 ms
+
+#define SESSION_SPEED    16  //!< Velocidad de la reproducción de la sesión capturada
+#define SESSION_REPLAYS  100 //!< Cantidad de reproducciones de la sesión en la medición del rendimiento
+#define SESSION_TIME_OUT 400000 //!< Milisegundos simulados máximos de una reproducción de la sesión
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdates(uint8_t segments);
+static void FakeDigitTurnOn(uint8_t digit);
+
+static void FakeRingingLed(bool on);
+static void FakeAlarmLed(uint8_t duty);
+static void FakeSound(bool play);
+static void FakeNotify(const char * event);
+static void FakeSave(const clockStateT * state);
+
+/**
+ * @brief Función de alarma del reloj, avisa a la interfaz igual que el programa principal.
+ */
+static void AlarmRinging(clockT clock);
+
+/**
+ * @brief Reproduce la sesión capturada sobre una interfaz nueva, leyendo las teclas con la capa de entradas.
+ *
+ * @return uint32_t Milisegundos simulados de la reproducción.
+ */
+static uint32_t ReplaySession(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/*
+ * Sesión volcada con el comando keys: configura la hora en 23:58 desde el reloj sin configurar, la alarma en 00:01,
+ * espera que suene y la cancela.
+ */
+static const uint16_t SESSION[] = {
+    PRESS(APP_KEY_SET_TIME, 500),  RELEASE(APP_KEY_SET_TIME, 120), PRESS(APP_KEY_DECREMENT, 300),
+    RELEASE(APP_KEY_DECREMENT, 80), PRESS(APP_KEY_DECREMENT, 200), RELEASE(APP_KEY_DECREMENT, 80),
+    PRESS(APP_KEY_ACCEPT, 400),    RELEASE(APP_KEY_ACCEPT, 100),   PRESS(APP_KEY_DECREMENT, 300),
+    RELEASE(APP_KEY_DECREMENT, 90), PRESS(APP_KEY_ACCEPT, 400),    RELEASE(APP_KEY_ACCEPT, 100),
+    PRESS(APP_KEY_SET_ALARM, 2000), RELEASE(APP_KEY_SET_ALARM, 100), PRESS(APP_KEY_INCREMENT, 300),
+    RELEASE(APP_KEY_INCREMENT, 80), PRESS(APP_KEY_ACCEPT, 300),    RELEASE(APP_KEY_ACCEPT, 100),
+    PRESS(APP_KEY_ACCEPT, 300),    RELEASE(APP_KEY_ACCEPT, 100),   PAUSE(45),
+    PRESS(APP_KEY_CANCEL, 0),      RELEASE(APP_KEY_CANCEL, 100),
+};
+
+static const struct screenDriverS screenDriver = {
+    .DigitsTurnOff = FakeDigitsTurnOff, .SegmentsUpdates = FakeSegmentsUpdates, .DigitTurnOn = FakeDigitTurnOn};
+
+static const struct appDriverS appDriver = {
+    .RingingLed = FakeRingingLed,
+    .AlarmLed = FakeAlarmLed,
+    .Sound = FakeSound,
+    .Notify = FakeNotify,
+    .Save = FakeSave,
+};
+
+static keylogT keylog;
+static volatile uint32_t keys;
+static volatile uint32_t now;
+static appT app;
+static bool sounding;
+static uint16_t rings;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+}
+
+static void FakeSegmentsUpdates(uint8_t segments) {
+    (void)segments;
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    (void)digit;
+}
+
+static void FakeRingingLed(bool on) {
+    (void)on;
+}
+
+static void FakeAlarmLed(uint8_t duty) {
+    (void)duty;
+}
+
+static void FakeSound(bool play) {
+    sounding = play;
+    rings += play;
+}
+
+static void FakeNotify(const char * event) {
+    (void)event;
+}
+
+static void FakeSave(const clockStateT * state) {
+    (void)state;
+}
+
+static void AlarmRinging(clockT clock) {
+    (void)clock;
+    AppAlarmRinging(app);
+}
+
+static uint32_t ReplaySession(void) {
+    clockT clock = ClockCreate(1000, AlarmRinging);
+    digitalInputT inputs[APP_KEYS];
+    uint32_t start = now;
+
+    app = AppCreate(clock, ScreenCreate(4, &screenDriver), &appDriver);
+    AppStart(app);
+    for (uint8_t key = 0; key < APP_KEYS; key++) {
+        inputs[key] = DigitalInputCreateWord(&keys, key, false);
+    }
+
+    // Igual que el lazo principal, con el reloj acelerado a la misma velocidad que la reproducción
+    KeylogReplay(keylog, SESSION_SPEED);
+    while (KeylogReplayPoll(keylog, now, &keys) && now - start < SESSION_TIME_OUT) {
+        for (uint8_t key = 0; key < APP_KEYS; key++) {
+            if (DigitalInputWasDeactivated(inputs[key])) {
+                AppKey(app, key);
+            }
+        }
+        now++;
+        AppTick(app, SESSION_SPEED);
+    }
+    return (now - start) * SESSION_SPEED;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Un registro nuevo está vacío y una capacidad nula se rechaza.
+ * - Cada cambio de una tecla ocupa una entrada, con el tiempo desde el cambio anterior.
+ * - Las pausas largas se registran con entradas adicionales sin perder precisión.
+ * - Al llenarse el registro se detiene la captura y se conserva el principio de la sesión.
+ * - La reproducción en tiempo real aplica cada cambio a la palabra de teclas en su instante.
+ * - La reproducción acelerada aplica un cambio por llamada para no perder flancos.
+ * - Durante la reproducción no se captura y una sesión cargada detiene la captura.
+ * - Al terminar la reproducción la captura cuenta los tiempos desde que se reanuda.
+ * - Una sesión capturada reproducida con la capa de entradas lleva la interfaz al mismo estado en cada reproducción.
+ */
+
+void setUp(void) {
+    keylog = KeylogCreate(TEST_CAPACITY);
+    keys = 0;
+    now = 0;
+    sounding = false;
+    rings = 0;
+    TraceInit(&now);
+}
+
+// Un registro nuevo está vacío y una capacidad nula se rechaza.
+void test_create_empty(void) {
+    const uint16_t * entries;
+
+    TEST_ASSERT_NOT_NULL(keylog);
+    TEST_ASSERT_NULL(KeylogCreate(0));
+    TEST_ASSERT_EQUAL(0, KeylogGetEntries(keylog, &entries));
+    TEST_ASSERT_FALSE(KeylogReplayPoll(keylog, 0, &keys));
+}
+
+// Cada cambio de una tecla ocupa una entrada, con el tiempo desde el cambio anterior.
+void test_capture_edges(void) {
+    const uint16_t * entries;
+    keylogEventT event;
+    uint16_t cursor = 0;
+    uint32_t time = 0;
+
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0, 1000));
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x01, 1100));
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x01, 1200));
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x20, 1250));
+
+    TEST_ASSERT_EQUAL(3, KeylogGetEntries(keylog, &entries));
+    TEST_ASSERT_EQUAL_HEX16(PRESS(0, 100), entries[0]);
+    TEST_ASSERT_EQUAL_HEX16(RELEASE(0, 150), entries[1]);
+    TEST_ASSERT_EQUAL_HEX16(PRESS(5, 0), entries[2]);
+
+    TEST_ASSERT_TRUE(KeylogDecode(entries, 3, &cursor, &time, &event));
+    TEST_ASSERT_EQUAL(100, event.time);
+    TEST_ASSERT_EQUAL(0, event.key);
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_TRUE(KeylogDecode(entries, 3, &cursor, &time, &event));
+    TEST_ASSERT_TRUE(KeylogDecode(entries, 3, &cursor, &time, &event));
+    TEST_ASSERT_EQUAL(250, event.time);
+    TEST_ASSERT_EQUAL(5, event.key);
+    TEST_ASSERT_FALSE(KeylogDecode(entries, 3, &cursor, &time, &event));
+}
+
+// Las pausas largas se registran con entradas adicionales sin perder precisión.
+void test_long_pause(void) {
+    const uint16_t * entries;
+    keylogEventT event;
+    uint16_t cursor = 0;
+    uint32_t time = 0;
+    uint16_t count;
+
+    KeylogCapture(keylog, 0, 0);
+    KeylogCapture(keylog, 0x04, 36000000 + 7);
+    count = KeylogGetEntries(keylog, &entries);
+    TEST_ASSERT_EQUAL(4, count);
+
+    TEST_ASSERT_TRUE(KeylogDecode(entries, count, &cursor, &time, &event));
+    TEST_ASSERT_EQUAL(36000007, event.time);
+    TEST_ASSERT_EQUAL(2, event.key);
+}
+
+// Al llenarse el registro se detiene la captura y se conserva el principio de la sesión.
+void test_full_stops_capture(void) {
+    const uint16_t * entries;
+
+    KeylogCapture(keylog, 0, 0);
+    for (uint8_t edge = 0; edge < TEST_CAPACITY - 1; edge++) {
+        TEST_ASSERT_TRUE(KeylogCapture(keylog, edge & 1 ? 0 : 0x02, 10 * edge));
+    }
+    // El cambio con pausa no entra completo y no se registra
+    TEST_ASSERT_FALSE(KeylogCapture(keylog, 0x00, 100000));
+    TEST_ASSERT_FALSE(KeylogCapture(keylog, 0x02, 100010));
+    TEST_ASSERT_EQUAL(TEST_CAPACITY - 1, KeylogGetEntries(keylog, &entries));
+    TEST_ASSERT_EQUAL_HEX16(PRESS(1, 0), entries[0]);
+
+    KeylogClear(keylog);
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x02, 200000));
+    TEST_ASSERT_EQUAL(1, KeylogGetEntries(keylog, &entries));
+}
+
+// La reproducción en tiempo real aplica cada cambio a la palabra de teclas en su instante.
+void test_replay_real_time(void) {
+    static const uint16_t entries[] = {PRESS(3, 100), RELEASE(3, 50)};
+
+    TEST_ASSERT_TRUE(KeylogLoad(keylog, entries, 2));
+    KeylogReplay(keylog, 1);
+    keys = 0xFF;
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 5000, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x00, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 5099, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x00, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 5100, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x08, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 5149, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x08, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 5150, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x00, keys);
+    TEST_ASSERT_FALSE(KeylogReplayPoll(keylog, 5151, &keys));
+}
+
+// La reproducción acelerada aplica un cambio por llamada para no perder flancos.
+void test_replay_accelerated(void) {
+    static const uint16_t entries[] = {PRESS(0, 400), RELEASE(0, 4), PRESS(1, 4)};
+
+    KeylogLoad(keylog, entries, 3);
+    KeylogReplay(keylog, 4);
+    KeylogReplayPoll(keylog, 0, &keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 99, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x00, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 110, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x01, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 110, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x00, keys);
+    TEST_ASSERT_TRUE(KeylogReplayPoll(keylog, 110, &keys));
+    TEST_ASSERT_EQUAL_HEX32(0x02, keys);
+    TEST_ASSERT_FALSE(KeylogReplayPoll(keylog, 110, &keys));
+}
+
+// Durante la reproducción no se captura y una sesión cargada detiene la captura.
+void test_replay_pauses_capture(void) {
+    static const uint16_t entries[] = {PRESS(2, 10), RELEASE(2, 10)};
+    const uint16_t * captured;
+
+    KeylogCapture(keylog, 0x01, 0);
+    KeylogReplay(keylog, 1);
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x00, 10));
+    TEST_ASSERT_EQUAL(1, KeylogGetEntries(keylog, &captured));
+    KeylogReplay(keylog, 0);
+
+    TEST_ASSERT_FALSE(KeylogLoad(keylog, entries, TEST_CAPACITY + 1));
+    TEST_ASSERT_TRUE(KeylogLoad(keylog, entries, 2));
+    TEST_ASSERT_FALSE(KeylogCapture(keylog, 0x01, 20));
+    TEST_ASSERT_EQUAL(2, KeylogGetEntries(keylog, &captured));
+}
+
+// Al terminar la reproducción la captura cuenta los tiempos desde que se reanuda.
+void test_capture_resumes_after_replay(void) {
+    const uint16_t * captured;
+
+    KeylogCapture(keylog, 0x01, 100);
+    KeylogReplay(keylog, 1);
+    KeylogCapture(keylog, 0x01, 200);
+    KeylogReplay(keylog, 0);
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x01, 5000));
+    TEST_ASSERT_TRUE(KeylogCapture(keylog, 0x00, 5010));
+    TEST_ASSERT_EQUAL(2, KeylogGetEntries(keylog, &captured));
+    TEST_ASSERT_EQUAL_HEX16(RELEASE(0, 10), captured[1]);
+}
+
+// Una sesión capturada reproducida con la capa de entradas lleva la interfaz al mismo estado en cada reproducción.
+void test_replay_session_workload(void) {
+    clock_t start;
+    double elapsed;
+    uint32_t simulated = 0;
+    char message[96];
+
+    keylog = KeylogCreate(sizeof(SESSION) / sizeof(SESSION[0]));
+    TEST_ASSERT_TRUE(KeylogLoad(keylog, SESSION, sizeof(SESSION) / sizeof(SESSION[0])));
+
+    start = clock();
+    for (uint16_t replay = 0; replay < SESSION_REPLAYS; replay++) {
+        rings = 0;
+        simulated += ReplaySession();
+        TEST_ASSERT_EQUAL(APP_SHOW_TIME, AppGetMode(app));
+        TEST_ASSERT_EQUAL(1, rings);
+        TEST_ASSERT_FALSE(sounding);
+    }
+    elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // El rendimiento depende de la computadora, se informa sin verificarlo
+    snprintf(message, sizeof(message), "%u reproducciones, %.0f s simulados en %.3f s", SESSION_REPLAYS,
+             simulated / 1000.0, elapsed);
+    TEST_MESSAGE(message);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,150 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_mailbox.c
+ ** @brief Archivo de pruebas unitarias para el buzón compartido entre los núcleos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "mailbox.h"
+#include "core_thread.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_READS     50        //!< Cuadros que debe leer el otro hilo antes de terminar la prueba
+#define TEST_PUBLISHES 100000000 //!< Máximo de cuadros que publica el núcleo principal mientras el otro hilo los lee
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultados del hilo que lee el buzón
+typedef struct readerS {
+    uint32_t reads; //!< Cuadros leídos
+    uint32_t torn;  //!< Cuadros leídos con palabras de publicaciones distintas
+} readerT;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lazo del hilo que reemplaza al núcleo secundario, lee cuadros y verifica que estén completos.
+ *
+ * @param context   Puntero a los resultados del hilo.
+ */
+static void Reader(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct mailboxS mailbox;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Reader(void * context) {
+    readerT * result = context;
+    uint32_t frame[MAILBOX_FRAME_WORDS];
+    uint32_t sequence = 0;
+
+    while (CoreThreadRunning()) {
+        if (MailboxFetch(&mailbox, frame, sizeof(frame), &sequence)) {
+            __atomic_add_fetch(&result->reads, 1, __ATOMIC_SEQ_CST);
+            for (uint8_t index = 1; index < MAILBOX_FRAME_WORDS; index++) {
+                if (frame[index] != frame[0]) {
+                    result->torn++;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Un cuadro publicado se lee una sola vez.
+ * - Un cuadro que se está escribiendo no se lee.
+ * - Un cuadro mayor al buzón se rechaza.
+ * - El núcleo secundario nunca lee un cuadro mezclado mientras el principal publica.
+ */
+
+void setUp(void) {
+    MailboxInit(&mailbox, 250, 1000);
+}
+
+// Un cuadro publicado se lee una sola vez.
+void test_publish_fetch(void) {
+    const uint8_t sent[5] = {1, 2, 3, 4, 5};
+    uint8_t received[5] = {0};
+    uint32_t sequence = 0;
+
+    TEST_ASSERT_FALSE(MailboxFetch(&mailbox, received, sizeof(received), &sequence));
+    TEST_ASSERT_TRUE(MailboxPublish(&mailbox, sent, sizeof(sent)));
+    TEST_ASSERT_TRUE(MailboxFetch(&mailbox, received, sizeof(received), &sequence));
+    TEST_ASSERT_EQUAL_MEMORY(sent, received, sizeof(sent));
+    TEST_ASSERT_FALSE(MailboxFetch(&mailbox, received, sizeof(received), &sequence));
+}
+
+// Un cuadro que se está escribiendo no se lee.
+void test_fetch_during_write(void) {
+    uint8_t data[4] = {0};
+    uint32_t sequence = 0;
+
+    mailbox.sequence = 1; // El productor comenzó a escribir
+    TEST_ASSERT_FALSE(MailboxFetch(&mailbox, data, sizeof(data), &sequence));
+    mailbox.sequence = 2;
+    TEST_ASSERT_TRUE(MailboxFetch(&mailbox, data, sizeof(data), &sequence));
+}
+
+// Un cuadro mayor al buzón se rechaza.
+void test_frame_too_large(void) {
+    uint8_t data[MAILBOX_FRAME_WORDS * 4 + 1] = {0};
+    uint32_t sequence = 0;
+
+    TEST_ASSERT_FALSE(MailboxPublish(&mailbox, data, sizeof(data)));
+    TEST_ASSERT_FALSE(MailboxFetch(&mailbox, data, sizeof(data), &sequence));
+}
+
+// El núcleo secundario nunca lee un cuadro mezclado mientras el principal publica.
+void test_concurrent_frames_not_torn(void) {
+    readerT result = {0};
+    uint32_t frame[MAILBOX_FRAME_WORDS];
+
+    TEST_ASSERT_TRUE(CoreThreadStart(Reader, &result));
+    // Se publica hasta que el otro hilo haya leído suficientes cuadros, aunque el host tenga un solo procesador
+    for (uint32_t count = 1; count <= TEST_PUBLISHES; count++) {
+        if (__atomic_load_n(&result.reads, __ATOMIC_SEQ_CST) >= TEST_READS) {
+            break;
+        }
+        for (uint8_t index = 0; index < MAILBOX_FRAME_WORDS; index++) {
+            frame[index] = count;
+        }
+        MailboxPublish(&mailbox, frame, sizeof(frame));
+    }
+    CoreThreadStop();
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TEST_READS, result.reads);
+    TEST_ASSERT_EQUAL_UINT32(0, result.torn);
+}
+
+/* === End of documentation ======================================================================================== */
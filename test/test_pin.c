@@ -0,0 +1,110 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pin.c
+ ** @brief Pruebas unitarias del acceso directo a pines.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "chip.h"
+#include "pin.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define LED    PIN(2, 11, false) //!< Salida activa en nivel alto
+#define BUTTON PIN(0, 4, true)   //!< Entrada activa en nivel bajo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Al configurar una salida queda inactiva y con el pin como salida.
+ * - Activar y desactivar escriben el registro de byte del pin.
+ * - Invertir escribe solo el bit del pin en el registro de inversión.
+ * - El estado de una entrada se lee del registro de palabra respetando la lógica invertida.
+ * - Los flancos se detectan comparando con el estado anterior.
+ */
+
+void setUp(void) {
+    HostGpioReset();
+}
+
+// Al configurar una salida queda inactiva y con el pin como salida.
+void test_output_init(void) {
+    PinOutputInit(LED);
+    PinOutputInit(BUTTON);
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[2][11]);
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[0][4]);
+    TEST_ASSERT_EQUAL_HEX32(1UL << 11, LPC_GPIO_PORT->DIR[2]);
+
+    PinInputInit(LED);
+    TEST_ASSERT_EQUAL_HEX32(0, LPC_GPIO_PORT->DIR[2]);
+}
+
+// Activar y desactivar escriben el registro de byte del pin.
+void test_activate_byte_register(void) {
+    PinActivate(LED);
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[2][11]);
+    PinDesactivate(LED);
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[2][11]);
+    PinActivate(BUTTON);
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[0][4]);
+}
+
+// Invertir escribe solo el bit del pin en el registro de inversión.
+void test_toggle_not_register(void) {
+    PinToggle(LED);
+    TEST_ASSERT_EQUAL_HEX32(1UL << 11, LPC_GPIO_PORT->NOT[2]);
+}
+
+// El estado de una entrada se lee del registro de palabra respetando la lógica invertida.
+void test_read_word_register(void) {
+    LPC_GPIO_PORT->W[0][4] = UINT32_MAX;
+    TEST_ASSERT_FALSE(PinIsActive(BUTTON));
+    LPC_GPIO_PORT->W[0][4] = 0;
+    TEST_ASSERT_TRUE(PinIsActive(BUTTON));
+}
+
+// Los flancos se detectan comparando con el estado anterior.
+void test_edges(void) {
+    bool last = false;
+
+    LPC_GPIO_PORT->W[0][4] = UINT32_MAX;
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_NO_CHANGE, PinWasChanged(BUTTON, &last));
+    LPC_GPIO_PORT->W[0][4] = 0;
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATE, PinWasChanged(BUTTON, &last));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_NO_CHANGE, PinWasChanged(BUTTON, &last));
+    LPC_GPIO_PORT->W[0][4] = UINT32_MAX;
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_DEACTIVATE, PinWasChanged(BUTTON, &last));
+}
+
+/* === End of documentation ======================================================================================== */
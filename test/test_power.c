@@ -0,0 +1,164 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_power.c
+ ** @brief Archivo de pruebas unitarias para la política de consumo según la actividad del usuario.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "power.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_DIM   1000 //!< Tiempo sin actividad para atenuar el display
+#define TEST_BLANK 5000 //!< Tiempo sin actividad para apagar el display
+#define TEST_SLOW  6000 //!< Tiempo sin actividad para hacer más lento el tick
+
+#define TEST_START 100 //!< Instante en que se crea la política
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static const uint32_t TIMEOUTS[POWER_LEVELS] = {
+    [POWER_DIMMED] = TEST_DIM,
+    [POWER_BLANK] = TEST_BLANK,
+    [POWER_SLOW] = TEST_SLOW,
+};
+
+static powerT power;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - La política comienza en funcionamiento normal.
+ * - Sin actividad el nivel baja a medida que se cumplen los tiempos.
+ * - Cualquier actividad vuelve inmediatamente al funcionamiento normal y reinicia los tiempos.
+ * - Un nivel deshabilitado se saltea.
+ * - Si se consulta tarde se pasa directamente al nivel que corresponde.
+ * - La permanencia en cada nivel suma el tiempo transcurrido hasta la última consulta.
+ * - La permanencia y el nivel se mantienen cuando el tiempo en un nivel supera 2^32 unidades.
+ */
+
+void setUp(void) {
+    power = PowerCreate(TIMEOUTS, TEST_START);
+}
+
+// La política comienza en funcionamiento normal.
+void test_starts_at_full(void) {
+    TEST_ASSERT_NOT_NULL(power);
+    TEST_ASSERT_EQUAL(POWER_FULL, PowerGetLevel(power));
+    TEST_ASSERT_FALSE(PowerPoll(power, TEST_START + TEST_DIM - 1));
+    TEST_ASSERT_EQUAL(POWER_FULL, PowerGetLevel(power));
+    TEST_ASSERT_NULL(PowerCreate(NULL, 0));
+}
+
+// Sin actividad el nivel baja a medida que se cumplen los tiempos.
+void test_steps_down_while_idle(void) {
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_DIM));
+    TEST_ASSERT_EQUAL(POWER_DIMMED, PowerGetLevel(power));
+    TEST_ASSERT_FALSE(PowerPoll(power, TEST_START + TEST_BLANK - 1));
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_BLANK));
+    TEST_ASSERT_EQUAL(POWER_BLANK, PowerGetLevel(power));
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_SLOW));
+    TEST_ASSERT_EQUAL(POWER_SLOW, PowerGetLevel(power));
+}
+
+// Cualquier actividad vuelve inmediatamente al funcionamiento normal y reinicia los tiempos.
+void test_activity_restores_full(void) {
+    PowerPoll(power, TEST_START + TEST_SLOW);
+    TEST_ASSERT_TRUE(PowerActivity(power, TEST_START + TEST_SLOW + 10));
+    TEST_ASSERT_EQUAL(POWER_FULL, PowerGetLevel(power));
+    TEST_ASSERT_FALSE(PowerActivity(power, TEST_START + TEST_SLOW + 20));
+
+    TEST_ASSERT_FALSE(PowerPoll(power, TEST_START + TEST_SLOW + 20 + TEST_DIM - 1));
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_SLOW + 20 + TEST_DIM));
+    TEST_ASSERT_EQUAL(POWER_DIMMED, PowerGetLevel(power));
+}
+
+// Un nivel deshabilitado se saltea.
+void test_disabled_level_is_skipped(void) {
+    static const uint32_t timeouts[POWER_LEVELS] = {[POWER_BLANK] = TEST_BLANK, [POWER_SLOW] = TEST_SLOW};
+
+    power = PowerCreate(timeouts, TEST_START);
+    TEST_ASSERT_FALSE(PowerPoll(power, TEST_START + TEST_DIM));
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_BLANK));
+    TEST_ASSERT_EQUAL(POWER_BLANK, PowerGetLevel(power));
+}
+
+// Si se consulta tarde se pasa directamente al nivel que corresponde.
+void test_late_poll_jumps_levels(void) {
+    powerStatsT stats;
+
+    TEST_ASSERT_TRUE(PowerPoll(power, TEST_START + TEST_SLOW + 1));
+    TEST_ASSERT_EQUAL(POWER_SLOW, PowerGetLevel(power));
+    TEST_ASSERT_TRUE(PowerGetStats(power, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.transitions);
+}
+
+// La permanencia en cada nivel suma el tiempo transcurrido hasta la última consulta.
+void test_residency_statistics(void) {
+    powerStatsT stats;
+
+    PowerPoll(power, TEST_START + TEST_DIM);
+    PowerPoll(power, TEST_START + TEST_BLANK);
+    PowerActivity(power, TEST_START + TEST_BLANK + 200);
+    PowerPoll(power, TEST_START + TEST_BLANK + 200 + TEST_DIM);
+    PowerPoll(power, TEST_START + TEST_BLANK + 200 + TEST_DIM + 50);
+
+    TEST_ASSERT_TRUE(PowerGetStats(power, &stats));
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIM, stats.residency[POWER_FULL]);
+    TEST_ASSERT_EQUAL_UINT32(TEST_BLANK - TEST_DIM + 50, stats.residency[POWER_DIMMED]);
+    TEST_ASSERT_EQUAL_UINT32(200, stats.residency[POWER_BLANK]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.residency[POWER_SLOW]);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.transitions);
+    TEST_ASSERT_FALSE(PowerGetStats(power, NULL));
+}
+
+// La permanencia y el nivel se mantienen cuando el tiempo en un nivel supera 2^32 unidades.
+void test_residency_beyond_32_bits(void) {
+    uint32_t now = TEST_START + TEST_SLOW;
+    powerStatsT stats;
+
+    PowerPoll(power, now);
+    for (uint8_t step = 0; step < 4; step++) {
+        now += 0x40000000;
+        TEST_ASSERT_FALSE(PowerPoll(power, now));
+    }
+    now += 1000;
+    TEST_ASSERT_FALSE(PowerPoll(power, now));
+    TEST_ASSERT_EQUAL(POWER_SLOW, PowerGetLevel(power));
+
+    TEST_ASSERT_TRUE(PowerGetStats(power, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(stats.residency[POWER_SLOW] >> 32));
+    TEST_ASSERT_EQUAL_UINT32(1000, (uint32_t)stats.residency[POWER_SLOW]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.transitions);
+}
+
+/* === End of documentation ======================================================================================== */
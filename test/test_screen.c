@@ -0,0 +1,311 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_screen.c
+ ** @brief Archivo de pruebas unitarias para la pantalla multiplexada de 7 segmentos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_DIGITS 4
+
+//! Imagen del número 1
+#define IMAGE_ONE (SEGMENT_B | SEGMENT_C)
+//! Imagen del número 2
+#define IMAGE_TWO (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+//! Imagen del número 3
+#define IMAGE_THREE (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+//! Imagen del número 4
+#define IMAGE_FOUR (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdates(uint8_t value);
+static void FakeDigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Cuenta los cuadros en los que el primer dígito se muestra apagado.
+ *
+ * @param frames  Cantidad de cuadros a refrescar.
+ * @return uint16_t Cantidad de cuadros con el primer dígito apagado.
+ */
+static uint16_t CountBlankFrames(uint16_t frames);
+
+/**
+ * @brief Refresca un cuadro completo y registra la imagen mostrada en cada dígito.
+ *
+ * @param images  Arreglo donde se guardan las imágenes de los dígitos.
+ */
+static void ShownImages(uint8_t images[TEST_DIGITS]);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screenDriverS driver = {
+    .DigitsTurnOff = FakeDigitsTurnOff, .SegmentsUpdates = FakeSegmentsUpdates, .DigitTurnOn = FakeDigitTurnOn};
+
+static screenT screen;
+static uint8_t segments;
+static int8_t digitOn;
+static uint16_t turnOns;
+static uint16_t blankTurnOns;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+    digitOn = -1;
+    segments = 0;
+}
+
+static void FakeSegmentsUpdates(uint8_t value) {
+    segments = value;
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    digitOn = digit;
+    turnOns++;
+    if (digit == 0 && segments == 0) {
+        blankTurnOns++;
+    }
+}
+
+static uint16_t CountBlankFrames(uint16_t frames) {
+    blankTurnOns = 0;
+    for (uint16_t refresh = 0; refresh < frames * TEST_DIGITS * SCREEN_BRIGHTNESS_BITS; refresh++) {
+        ScreenRefresh(screen);
+    }
+    return blankTurnOns;
+}
+
+static void ShownImages(uint8_t images[TEST_DIGITS]) {
+    for (uint8_t refresh = 0; refresh < TEST_DIGITS * SCREEN_BRIGHTNESS_BITS; refresh++) {
+        ScreenRefresh(screen);
+        if (digitOn >= 0) {
+            images[digitOn] = segments;
+        }
+    }
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Cada refresco enciende el dígito siguiente con su imagen.
+ * - Apagar la pantalla hasta el próximo refresco.
+ * - Con brillo máximo cada dígito se enciende una sola vez por turno.
+ * - El brillo se modula con intervalos de pesos binarios.
+ * - El brillo se puede ajustar por dígito.
+ * - La duración del parpadeo no depende de la frecuencia del barrido.
+ * - Convertir un valor HH:MM empaquetado en un cuadro de cuatro dígitos.
+ * - Los pares que no son BCD válido se muestran en blanco.
+ * - Los puntos se superponen al cuadro y se muestran en su dígito.
+ * - Escribir un dígito que no es BCD válido lo muestra en blanco.
+ * - Dos regiones parpadean con frecuencias independientes.
+ * - Una región de solo SEGMENT_DP parpadea el punto sin apagar el dígito.
+ * - Los puntos fijos se conservan al escribir nuevos valores.
+ * - Una región fuera de rango se rechaza.
+ */
+
+void setUp(void) {
+    static uint8_t ones[TEST_DIGITS] = {1, 1, 1, 1};
+
+    screen = ScreenCreate(TEST_DIGITS, &driver);
+    turnOns = 0;
+    ScreenWriteBCD(screen, ones, sizeof(ones));
+}
+
+// Cada refresco enciende el dígito siguiente con su imagen.
+void test_refresh_scans_digits(void) {
+    for (uint8_t digit = 1; digit <= TEST_DIGITS; digit++) {
+        for (uint8_t bit = 0; bit < SCREEN_BRIGHTNESS_BITS; bit++) {
+            TEST_ASSERT_EQUAL_UINT8(1 << bit, ScreenRefresh(screen));
+            TEST_ASSERT_EQUAL_INT8(digit % TEST_DIGITS, digitOn);
+            TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, segments);
+        }
+    }
+}
+
+// Apagar la pantalla hasta el próximo refresco.
+void test_blank(void) {
+    ScreenRefresh(screen);
+    ScreenBlank(screen);
+    TEST_ASSERT_EQUAL_INT8(-1, digitOn);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_INT8(1, digitOn); // El intervalo siguiente vuelve a encender el dígito
+}
+
+// Con brillo máximo cada dígito se enciende una sola vez por turno.
+void test_full_brightness_single_turn_on(void) {
+    CountBlankFrames(3);
+    TEST_ASSERT_EQUAL_UINT16(3 * TEST_DIGITS, turnOns);
+}
+
+// El brillo se modula con intervalos de pesos binarios.
+void test_bit_angle_modulation(void) {
+    uint16_t lit = 0, total = 0;
+    uint8_t weight;
+
+    ScreenSetBrightness(screen, 5);
+    for (uint8_t refresh = 0; refresh < TEST_DIGITS * SCREEN_BRIGHTNESS_BITS; refresh++) {
+        weight = ScreenRefresh(screen);
+        total += weight;
+        lit += (digitOn >= 0) ? weight : 0;
+    }
+    TEST_ASSERT_EQUAL_UINT16(TEST_DIGITS * SCREEN_BRIGHTNESS_MAX, total);
+    TEST_ASSERT_EQUAL_UINT16(TEST_DIGITS * 5, lit);
+
+    ScreenSetBrightness(screen, 0);
+    turnOns = 0;
+    CountBlankFrames(2);
+    TEST_ASSERT_EQUAL_UINT16(0, turnOns);
+}
+
+// El brillo se puede ajustar por dígito.
+void test_digit_brightness(void) {
+    uint16_t lit[TEST_DIGITS] = {0};
+    uint8_t weight;
+
+    TEST_ASSERT_TRUE(ScreenSetDigitBrightness(screen, 2, 1));
+    TEST_ASSERT_FALSE(ScreenSetDigitBrightness(screen, TEST_DIGITS, 1));
+    for (uint8_t refresh = 0; refresh < TEST_DIGITS * SCREEN_BRIGHTNESS_BITS; refresh++) {
+        weight = ScreenRefresh(screen);
+        if (digitOn >= 0) {
+            lit[digitOn] += weight;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT16(SCREEN_BRIGHTNESS_MAX, lit[1]);
+    TEST_ASSERT_EQUAL_UINT16(1, lit[2]);
+}
+
+// La duración del parpadeo no depende de la frecuencia del barrido.
+void test_flash_duration_follows_frame_rate(void) {
+    ScreenFlashDigits(screen, 0, 0, 10);
+    TEST_ASSERT_EQUAL_UINT16(10, CountBlankFrames(20));
+
+    ScreenSetFrameRate(screen, 2 * SCREEN_FRAME_RATE);
+    TEST_ASSERT_EQUAL_UINT16(20, CountBlankFrames(40));
+
+    ScreenFlashDigits(screen, 0, 0, 10);
+    TEST_ASSERT_EQUAL_UINT16(20, CountBlankFrames(40));
+}
+
+// Convertir un valor HH:MM empaquetado en un cuadro de cuatro dígitos.
+void test_render_packed_time(void) {
+    uint32_t frame = ScreenRenderBCD(0x1234);
+
+    TEST_ASSERT_EQUAL_HEX32(IMAGE_ONE | IMAGE_TWO << 8 | (uint32_t)IMAGE_THREE << 16 | (uint32_t)IMAGE_FOUR << 24,
+                            frame);
+}
+
+// Los pares que no son BCD válido se muestran en blanco.
+void test_render_invalid_pairs_blank(void) {
+    TEST_ASSERT_EQUAL_HEX32((uint32_t)(IMAGE_THREE | IMAGE_FOUR << 8) << 16, ScreenRenderBCD(0x1A34));
+    TEST_ASSERT_EQUAL_HEX32(IMAGE_ONE | IMAGE_TWO << 8, ScreenRenderBCD(0x12F4));
+}
+
+// Los puntos se superponen al cuadro y se muestran en su dígito.
+void test_write_frame_with_dots(void) {
+    uint8_t images[TEST_DIGITS] = {0};
+
+    ScreenWriteFrame(screen, ScreenRenderBCD(0x1111) | SCREEN_FRAME_DOT(1) | SCREEN_FRAME_DOT(3));
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE | SEGMENT_DP, images[1]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE | SEGMENT_DP, images[3]);
+}
+
+// Escribir un dígito que no es BCD válido lo muestra en blanco.
+void test_write_invalid_digit_blank(void) {
+    uint8_t value[TEST_DIGITS] = {1, 0x0C, 0xFF, 1};
+    uint8_t images[TEST_DIGITS] = {0};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, images[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, images[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[3]);
+}
+
+// Dos regiones parpadean con frecuencias independientes.
+void test_independent_flash_regions(void) {
+    uint8_t images[TEST_DIGITS];
+    uint16_t blank[TEST_DIGITS] = {0};
+
+    TEST_ASSERT_EQUAL_INT(0, ScreenFlashRegion(screen, 0, 0, 1, SCREEN_FLASH_ALL, 2));
+    TEST_ASSERT_EQUAL_INT(0, ScreenFlashRegion(screen, 1, 3, 3, SCREEN_FLASH_ALL, 5));
+    for (uint8_t frame = 0; frame < 20; frame++) {
+        ShownImages(images);
+        for (uint8_t digit = 0; digit < TEST_DIGITS; digit++) {
+            blank[digit] += (images[digit] == 0);
+            images[digit] = 0;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT16(10, blank[0]);
+    TEST_ASSERT_EQUAL_UINT16(10, blank[1]);
+    TEST_ASSERT_EQUAL_UINT16(0, blank[2]);
+    TEST_ASSERT_EQUAL_UINT16(10, blank[3]);
+}
+
+// Una región de solo SEGMENT_DP parpadea el punto sin apagar el dígito.
+void test_flash_dot_only(void) {
+    uint8_t images[TEST_DIGITS];
+    uint16_t dots = 0;
+
+    ScreenSetDots(screen, 1 << 1);
+    ScreenFlashRegion(screen, 1, 1, 1, SEGMENT_DP, 5);
+    for (uint8_t frame = 0; frame < 20; frame++) {
+        ShownImages(images);
+        TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[1] & ~SEGMENT_DP);
+        dots += (images[1] & SEGMENT_DP) != 0;
+    }
+    TEST_ASSERT_EQUAL_UINT16(10, dots);
+}
+
+// Los puntos fijos se conservan al escribir nuevos valores.
+void test_dots_survive_writes(void) {
+    uint8_t images[TEST_DIGITS] = {0};
+
+    ScreenSetDots(screen, 1 << 0 | 1 << 2);
+    ScreenWriteFrame(screen, ScreenRenderBCD(0x1111));
+    ShownImages(images);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE | SEGMENT_DP, images[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[1]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE | SEGMENT_DP, images[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_ONE, images[3]);
+}
+
+// Una región fuera de rango se rechaza.
+void test_flash_region_out_of_range(void) {
+    TEST_ASSERT_EQUAL_INT(-1, ScreenFlashRegion(screen, SCREEN_FLASH_REGIONS, 0, 0, SCREEN_FLASH_ALL, 10));
+    TEST_ASSERT_EQUAL_INT(-1, ScreenFlashRegion(screen, 0, 2, 1, SCREEN_FLASH_ALL, 10));
+}
+
+/* === End of documentation ======================================================================================== */
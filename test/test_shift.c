@@ -0,0 +1,162 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_shift.c
+ ** @brief Pruebas unitarias del driver de pantalla con registros de desplazamiento.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include "shift.h"
+#include "shift_chain.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Imagen del número 2
+#define IMAGE_TWO (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Crea una pantalla conectada a la cadena simulada con todos sus dígitos en dos.
+ *
+ * @param digits  Cantidad de dígitos de la pantalla.
+ * @return screenT Pantalla creada.
+ */
+static screenT CreateScreen(uint8_t digits);
+
+/**
+ * @brief Refresca la pantalla hasta completar el turno de un dígito.
+ *
+ * @param screen  Pantalla a refrescar.
+ */
+static void RefreshDigit(screenT screen);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static screenT CreateScreen(uint8_t digits) {
+    uint8_t twos[SCREEN_MAX_DIGITS];
+    screenT screen;
+
+    ShiftChainInit(SHIFT_FRAME_SIZE(digits));
+    screen = ScreenCreate(digits, ShiftScreenCreate(digits, ShiftChainSend));
+    for (uint8_t index = 0; index < digits; index++) {
+        twos[index] = 2;
+    }
+    ScreenWriteBCD(screen, twos, digits);
+    return screen;
+}
+
+static void RefreshDigit(screenT screen) {
+    for (uint8_t bit = 0; bit < SCREEN_BRIGHTNESS_BITS; bit++) {
+        ScreenRefresh(screen);
+    }
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Al crear el driver se apagan todas las salidas de la cadena.
+ * - Cada dígito de una pantalla de seis dígitos se enciende con una única trama.
+ * - Una pantalla de dieciséis dígitos usa tres registros.
+ * - Los intervalos del brillo que no cambian el estado del dígito no envían tramas.
+ * - Apagar la pantalla envía una trama con todas las salidas en cero.
+ * - No se puede crear el driver con parámetros inválidos.
+ */
+
+void setUp(void) {
+    ShiftChainInit(0);
+}
+
+// Al crear el driver se apagan todas las salidas de la cadena.
+void test_create_clears_outputs(void) {
+    ShiftChainInit(2);
+    TEST_ASSERT_NOT_NULL(ShiftScreenCreate(6, ShiftChainSend));
+    TEST_ASSERT_EQUAL_UINT16(1, ShiftChainLatches());
+    TEST_ASSERT_EQUAL_UINT16(16, ShiftChainLastBits());
+    TEST_ASSERT_EQUAL_UINT8(0, ShiftChainOutput(0));
+    TEST_ASSERT_EQUAL_UINT8(0, ShiftChainOutput(1));
+}
+
+// Cada dígito de una pantalla de seis dígitos se enciende con una única trama.
+void test_six_digits_one_frame_per_digit(void) {
+    screenT screen = CreateScreen(6);
+    uint16_t latches;
+
+    for (uint8_t digit = 1; digit <= 6; digit++) {
+        latches = ShiftChainLatches();
+        RefreshDigit(screen);
+        TEST_ASSERT_EQUAL_UINT16(latches + 1, ShiftChainLatches());
+        TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, ShiftChainOutput(0));
+        TEST_ASSERT_EQUAL_HEX8(1 << (digit % 6), ShiftChainOutput(1));
+    }
+}
+
+// Una pantalla de dieciséis dígitos usa tres registros.
+void test_sixteen_digits(void) {
+    screenT screen = CreateScreen(16);
+
+    for (uint8_t digit = 1; digit <= 9; digit++) {
+        RefreshDigit(screen);
+    }
+    TEST_ASSERT_EQUAL_UINT16(24, ShiftChainLastBits());
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_TWO, ShiftChainOutput(0));
+    TEST_ASSERT_EQUAL_HEX8(0x00, ShiftChainOutput(1));
+    TEST_ASSERT_EQUAL_HEX8(1 << 1, ShiftChainOutput(2));
+}
+
+// Los intervalos del brillo que no cambian el estado del dígito no envían tramas.
+void test_unchanged_intervals_send_nothing(void) {
+    screenT screen = CreateScreen(6);
+    uint16_t latches = ShiftChainLatches();
+
+    ScreenSetBrightness(screen, 1);
+    RefreshDigit(screen);
+    TEST_ASSERT_EQUAL_UINT16(latches + 2, ShiftChainLatches()); // Enciende en el peso uno y apaga en el peso dos
+    TEST_ASSERT_EQUAL_UINT8(0, ShiftChainOutput(1));
+}
+
+// Apagar la pantalla envía una trama con todas las salidas en cero.
+void test_blank_clears_outputs(void) {
+    screenT screen = CreateScreen(6);
+
+    ScreenRefresh(screen);
+    ScreenBlank(screen);
+    TEST_ASSERT_EQUAL_UINT8(0, ShiftChainOutput(0));
+    TEST_ASSERT_EQUAL_UINT8(0, ShiftChainOutput(1));
+}
+
+// No se puede crear el driver con parámetros inválidos.
+void test_invalid_parameters(void) {
+    TEST_ASSERT_NULL(ShiftScreenCreate(0, ShiftChainSend));
+    TEST_ASSERT_NULL(ShiftScreenCreate(SCREEN_MAX_DIGITS + 1, ShiftChainSend));
+    TEST_ASSERT_NULL(ShiftScreenCreate(4, NULL));
+}
+
+/* === End of documentation ======================================================================================== */
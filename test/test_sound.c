@@ -0,0 +1,181 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_sound.c
+ ** @brief Pruebas unitarias del secuenciador de melodías.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "sound.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeTone(uint16_t frequency);
+static void FakeSchedule(uint16_t delay);
+
+/**
+ * @brief Simula el vencimiento del temporizador una cantidad de veces.
+ *
+ * @param times  Cantidad de notas a avanzar.
+ */
+static void Advance(uint16_t times);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct soundDriverS driver = {.Tone = FakeTone, .Schedule = FakeSchedule};
+
+static const soundNoteT BEEP[] = {{SOUND_A4, 10}, {SOUND_REST, 90}};
+static const soundNoteT TRILL[] = {{SOUND_C7, 5}, {SOUND_E7, 5}, {SOUND_G7, 5}};
+
+static const soundPatternT ESCALATING[] = {SOUND_PATTERN(BEEP, 2), SOUND_PATTERN(TRILL, 0)};
+static const soundPatternT ONCE[] = {SOUND_PATTERN(BEEP, 1)};
+
+static soundT sound;
+static uint16_t tone;
+static uint16_t scheduled;
+static uint16_t tones;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeTone(uint16_t frequency) {
+    tone = frequency;
+    tones++;
+}
+
+static void FakeSchedule(uint16_t delay) {
+    scheduled = delay;
+}
+
+static void Advance(uint16_t times) {
+    for (uint16_t index = 0; index < times; index++) {
+        SoundNext(sound);
+    }
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Las frecuencias de las notas se calculan a partir de la octava más alta.
+ * - Al reproducir se genera la primera nota y se programa su duración.
+ * - Cada vencimiento del temporizador genera una única nota.
+ * - Un patrón se repite y luego la secuencia escala al siguiente.
+ * - El último patrón sin límite de repeticiones se repite siempre.
+ * - Una secuencia con límite termina sola y silencia el zumbador.
+ * - Al detener se silencia el zumbador y se cancela el temporizador.
+ * - No se reproducen secuencias inválidas.
+ */
+
+void setUp(void) {
+    sound = SoundCreate(&driver);
+    tone = 0;
+    scheduled = 0;
+    tones = 0;
+}
+
+// Las frecuencias de las notas se calculan a partir de la octava más alta.
+void test_note_frequencies(void) {
+    TEST_ASSERT_EQUAL_UINT16(0, SoundFrequency(SOUND_REST));
+    TEST_ASSERT_EQUAL_UINT16(440, SoundFrequency(SOUND_A4));
+    TEST_ASSERT_EQUAL_UINT16(262, SoundFrequency(60));
+    TEST_ASSERT_EQUAL_UINT16(3520, SoundFrequency(SOUND_A7));
+    TEST_ASSERT_EQUAL_UINT16(12544, SoundFrequency(127));
+}
+
+// Al reproducir se genera la primera nota y se programa su duración.
+void test_play_starts_first_note(void) {
+    TEST_ASSERT_TRUE(SoundPlay(sound, ESCALATING, 2));
+    TEST_ASSERT_TRUE(SoundIsPlaying(sound));
+    TEST_ASSERT_EQUAL_UINT16(440, tone);
+    TEST_ASSERT_EQUAL_UINT16(10 * SOUND_TICK, scheduled);
+}
+
+// Cada vencimiento del temporizador genera una única nota.
+void test_one_tone_per_note(void) {
+    SoundPlay(sound, ESCALATING, 2);
+    Advance(1);
+    TEST_ASSERT_EQUAL_UINT16(2, tones);
+    TEST_ASSERT_EQUAL_UINT16(0, tone);
+    TEST_ASSERT_EQUAL_UINT16(90 * SOUND_TICK, scheduled);
+}
+
+// Un patrón se repite y luego la secuencia escala al siguiente.
+void test_escalates_after_repeats(void) {
+    SoundPlay(sound, ESCALATING, 2);
+    Advance(3);
+    TEST_ASSERT_EQUAL_UINT8(0, SoundGetLevel(sound));
+    TEST_ASSERT_EQUAL_UINT16(0, tone);
+    Advance(1);
+    TEST_ASSERT_EQUAL_UINT8(1, SoundGetLevel(sound));
+    TEST_ASSERT_EQUAL_UINT16(SoundFrequency(SOUND_C7), tone);
+    TEST_ASSERT_EQUAL_UINT16(5 * SOUND_TICK, scheduled);
+}
+
+// El último patrón sin límite de repeticiones se repite siempre.
+void test_last_pattern_repeats_forever(void) {
+    SoundPlay(sound, ESCALATING, 2);
+    Advance(4 + 3 * 100);
+    TEST_ASSERT_TRUE(SoundIsPlaying(sound));
+    TEST_ASSERT_EQUAL_UINT8(1, SoundGetLevel(sound));
+    TEST_ASSERT_EQUAL_UINT16(SoundFrequency(SOUND_C7), tone);
+}
+
+// Una secuencia con límite termina sola y silencia el zumbador.
+void test_sequence_ends(void) {
+    SoundPlay(sound, ONCE, 1);
+    Advance(2);
+    TEST_ASSERT_FALSE(SoundIsPlaying(sound));
+    TEST_ASSERT_EQUAL_UINT16(0, tone);
+    TEST_ASSERT_EQUAL_UINT16(0, scheduled);
+}
+
+// Al detener se silencia el zumbador y se cancela el temporizador.
+void test_stop(void) {
+    SoundPlay(sound, ESCALATING, 2);
+    SoundStop(sound);
+    TEST_ASSERT_FALSE(SoundIsPlaying(sound));
+    TEST_ASSERT_EQUAL_UINT16(0, tone);
+    TEST_ASSERT_EQUAL_UINT16(0, scheduled);
+
+    tones = 0;
+    Advance(1); // Un vencimiento que ya estaba pendiente no vuelve a encender el zumbador
+    TEST_ASSERT_EQUAL_UINT16(0, tones);
+}
+
+// No se reproducen secuencias inválidas.
+void test_invalid_sequences(void) {
+    static const soundPatternT EMPTY[] = {{BEEP, 0, 1}};
+
+    TEST_ASSERT_FALSE(SoundPlay(sound, NULL, 1));
+    TEST_ASSERT_FALSE(SoundPlay(sound, ESCALATING, 0));
+    TEST_ASSERT_FALSE(SoundPlay(sound, EMPTY, 1));
+    TEST_ASSERT_FALSE(SoundIsPlaying(sound));
+    TEST_ASSERT_NULL(SoundCreate(NULL));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,110 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_stack.c
+ ** @brief Archivo de pruebas unitarias para la medición del uso de la pila.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "stack.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_STACK_WORDS 256
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t stack[TEST_STACK_WORDS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Una región inválida no reemplaza a la región pintada.
+ * - Con la pila recién pintada el uso es nulo.
+ * - El uso corresponde a la palabra modificada más profunda.
+ * - Se registra la máxima anidación de interrupciones y la profundidad del programa principal al ser interrumpido.
+ */
+
+void setUp(void) {
+    StackMonitorInit(stack, &stack[TEST_STACK_WORDS]);
+}
+
+// Una región inválida no reemplaza a la región pintada.
+void test_invalid_region(void) {
+    stackStatsT stats;
+
+    StackMonitorInit(&stack[TEST_STACK_WORDS], stack);
+    TEST_ASSERT_TRUE(StackMonitorGet(&stats));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(stack), stats.size);
+    TEST_ASSERT_FALSE(StackMonitorGet(NULL));
+}
+
+// Con la pila recién pintada el uso es nulo.
+void test_fresh_paint(void) {
+    stackStatsT stats;
+
+    TEST_ASSERT_TRUE(StackMonitorGet(&stats));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(stack), stats.size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.used);
+    TEST_ASSERT_EQUAL_UINT8(0, stats.nesting);
+}
+
+// El uso corresponde a la palabra modificada más profunda.
+void test_high_water_mark(void) {
+    stackStatsT stats;
+
+    stack[TEST_STACK_WORDS - 1] = 0;
+    stack[TEST_STACK_WORDS - 40] = 0; // Las palabras intermedias pueden conservar el patrón por casualidad
+    StackMonitorGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(40 * sizeof(uint32_t), stats.used);
+
+    stack[TEST_STACK_WORDS - 10] = 0; // Un uso menor no cambia la marca
+    StackMonitorGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(40 * sizeof(uint32_t), stats.used);
+}
+
+// Se registra la máxima anidación de interrupciones y la profundidad del programa principal al ser interrumpido.
+void test_interrupt_nesting(void) {
+    stackStatsT stats;
+
+    StackMonitorEnter(&stack[TEST_STACK_WORDS - 20]);
+    StackMonitorEnter(&stack[TEST_STACK_WORDS - 50]);
+    StackMonitorExit();
+    StackMonitorExit();
+    StackMonitorEnter(&stack[TEST_STACK_WORDS - 8]);
+    StackMonitorExit();
+
+    StackMonitorGet(&stats);
+    TEST_ASSERT_EQUAL_UINT8(2, stats.nesting);
+    TEST_ASSERT_EQUAL_UINT32(20 * sizeof(uint32_t), stats.preempted);
+}
+
+/* === End of documentation ======================================================================================== */
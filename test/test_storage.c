@@ -0,0 +1,191 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_storage.c
+ ** @brief Archivo de pruebas unitarias para el almacenamiento no volátil.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "storage.h"
+#include "eeprom_file.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TEST_EEPROM_PATH "test_storage.eeprom"
+#define TEST_EEPROM_SIZE 1024
+#define TEST_HOLDOFF     10
+#define TEST_SLOTS       (TEST_EEPROM_SIZE / STORAGE_SLOT_SIZE)
+
+/* === Private data type declarations ============================================================================== */
+
+typedef struct settingsS {
+    uint32_t time;
+    uint32_t alarm;
+    uint8_t flags;
+} settingsT;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Simula un reinicio creando una nueva instancia del almacenamiento sobre el mismo archivo.
+ *
+ * @return storageT Nueva instancia del almacenamiento.
+ */
+static storageT Reboot(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static storageT storage;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static storageT Reboot(void) {
+    EepromFileClose();
+    return StorageCreate(EepromFileCreate(TEST_EEPROM_PATH, TEST_EEPROM_SIZE), TEST_HOLDOFF);
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Con la memoria borrada no hay datos para recuperar.
+ * - Guardar datos y recuperarlos luego de un reinicio.
+ * - Varios cambios seguidos se escriben una sola vez al terminar el tiempo de espera.
+ * - Las escrituras se reparten sobre toda la memoria.
+ * - Un registro dañado se descarta y se recupera el anterior.
+ * - Luego de recuperar los datos, las nuevas escrituras continúan el log sin pisar el último registro.
+ */
+
+void setUp(void) {
+    remove(TEST_EEPROM_PATH);
+    storage = StorageCreate(EepromFileCreate(TEST_EEPROM_PATH, TEST_EEPROM_SIZE), TEST_HOLDOFF);
+}
+
+void tearDown(void) {
+    EepromFileClose();
+    remove(TEST_EEPROM_PATH);
+}
+
+// Con la memoria borrada no hay datos para recuperar.
+void test_restore_from_erased_memory(void) {
+    settingsT settings;
+
+    TEST_ASSERT_NOT_NULL(storage);
+    TEST_ASSERT_FALSE(StorageRestore(storage, &settings, sizeof(settings)));
+}
+
+// Guardar datos y recuperarlos luego de un reinicio.
+void test_save_and_restore(void) {
+    settingsT saved = {.time = 43200, .alarm = 25200, .flags = 3};
+    settingsT restored = {0};
+
+    TEST_ASSERT_TRUE(StorageSave(storage, &saved, sizeof(saved), 0));
+    TEST_ASSERT_TRUE(StoragePoll(storage, TEST_HOLDOFF));
+
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &restored, sizeof(restored)));
+    TEST_ASSERT_EQUAL_MEMORY(&saved, &restored, sizeof(settingsT));
+}
+
+// Varios cambios seguidos se escriben una sola vez al terminar el tiempo de espera.
+void test_save_coalescing(void) {
+    settingsT settings = {0};
+
+    for (uint32_t now = 0; now < 5; now++) {
+        settings.time = now;
+        StorageSave(storage, &settings, sizeof(settings), now);
+        TEST_ASSERT_FALSE(StoragePoll(storage, now));
+    }
+    TEST_ASSERT_FALSE(StoragePoll(storage, 4 + TEST_HOLDOFF - 1));
+    TEST_ASSERT_TRUE(StoragePoll(storage, 4 + TEST_HOLDOFF));
+    TEST_ASSERT_FALSE(StoragePoll(storage, 100));
+
+    TEST_ASSERT_EQUAL_UINT32(1, EepromFileWrites(0, TEST_EEPROM_SIZE));
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &settings, sizeof(settings)));
+    TEST_ASSERT_EQUAL_UINT32(4, settings.time);
+}
+
+// Las escrituras se reparten sobre toda la memoria.
+void test_wear_leveling(void) {
+    settingsT settings = {0};
+
+    for (uint32_t write = 0; write < 4 * TEST_SLOTS; write++) {
+        settings.time = write;
+        StorageSave(storage, &settings, sizeof(settings), 0);
+        StorageFlush(storage);
+    }
+    for (uint32_t slot = 0; slot < TEST_SLOTS; slot++) {
+        TEST_ASSERT_EQUAL_UINT32(4, EepromFileWrites(slot * STORAGE_SLOT_SIZE, STORAGE_SLOT_SIZE));
+    }
+
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &settings, sizeof(settings)));
+    TEST_ASSERT_EQUAL_UINT32(4 * TEST_SLOTS - 1, settings.time);
+}
+
+// Un registro dañado se descarta y se recupera el anterior.
+void test_corrupted_record_is_skipped(void) {
+    settingsT settings = {.time = 1};
+    FILE * file;
+
+    StorageSave(storage, &settings, sizeof(settings), 0);
+    StorageFlush(storage);
+    settings.time = 2;
+    StorageSave(storage, &settings, sizeof(settings), 0);
+    StorageFlush(storage);
+
+    EepromFileClose();
+    file = fopen(TEST_EEPROM_PATH, "r+b");
+    fseek(file, STORAGE_SLOT_SIZE + 10, SEEK_SET); // Datos del segundo registro
+    fputc(0xA5, file);
+    fclose(file);
+
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &settings, sizeof(settings)));
+    TEST_ASSERT_EQUAL_UINT32(1, settings.time);
+}
+
+// Luego de recuperar los datos, las nuevas escrituras continúan el log sin pisar el último registro.
+void test_restore_continues_log(void) {
+    settingsT settings = {.time = 1};
+
+    StorageSave(storage, &settings, sizeof(settings), 0);
+    StorageFlush(storage);
+
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &settings, sizeof(settings)));
+    settings.time = 2;
+    StorageSave(storage, &settings, sizeof(settings), 0);
+    StorageFlush(storage);
+    TEST_ASSERT_EQUAL_UINT32(1, EepromFileWrites(STORAGE_SLOT_SIZE, STORAGE_SLOT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0, EepromFileWrites(0, STORAGE_SLOT_SIZE));
+
+    storage = Reboot();
+    TEST_ASSERT_TRUE(StorageRestore(storage, &settings, sizeof(settings)));
+    TEST_ASSERT_EQUAL_UINT32(2, settings.time);
+}
+
+/* === End of documentation ======================================================================================== */
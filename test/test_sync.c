@@ -0,0 +1,239 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_sync.c
+ ** @brief Archivo de pruebas unitarias para la sincronización del reloj con una referencia externa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "sync.h"
+#include "clock.h"
+#include "calendar.h"
+#include "timezone.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CLOCK_TICK_PER_SECONDS 10000
+#define TEST_BUFFER_SIZE       128
+
+//! Segundos UTC del 2025-03-15 12:00:00
+#define TEST_REFERENCE_UTC 1742040000UL
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint16_t FakeRead(uint8_t * data, uint16_t size);
+
+/**
+ * @brief Simula la recepción de una sentencia NMEA, agregando la suma de verificación y el fin de línea.
+ *
+ * @param body  Contenido de la sentencia entre $ y *.
+ * @return true Si la sincronización aplicó la referencia.
+ */
+static bool Receive(const char * body);
+
+/**
+ * @brief Simula el paso del tiempo real con un oscilador que se aparta de la frecuencia nominal.
+ *
+ * @param ticks  Cantidad de ticks del oscilador.
+ */
+static void Run(uint32_t ticks);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct syncDriverS driver = {.Read = FakeRead};
+
+static clockT clock;
+static syncT sync;
+static char input[TEST_BUFFER_SIZE];
+static uint16_t inputLength;
+static uint16_t inputPosition;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t FakeRead(uint8_t * data, uint16_t size) {
+    uint16_t count = inputLength - inputPosition;
+
+    count = count < size ? count : size;
+    memcpy(data, &input[inputPosition], count);
+    inputPosition += count;
+    return count;
+}
+
+static bool Receive(const char * body) {
+    uint8_t checksum = 0;
+
+    for (const char * text = body; *text; text++) {
+        checksum ^= (uint8_t)*text;
+    }
+    inputLength = snprintf(input, sizeof(input), "$%s*%02X\r\n", body, checksum);
+    inputPosition = 0;
+    return SyncPoll(sync);
+}
+
+static void Run(uint32_t ticks) {
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        ClockNewTick(clock);
+    }
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - La primera referencia ajusta la hora y la fecha en forma inmediata.
+ * - Se aceptan sentencias ZDA de cualquier emisor.
+ * - Se descartan sentencias con suma de verificación inválida o sin posición válida.
+ * - Las sentencias de hora con campos mal formados se cuentan como errores, las de otros tipos se ignoran.
+ * - Un desfasaje pequeño se corrige variando la frecuencia, sin saltos en la hora.
+ * - Un desfasaje grande luego de sincronizar se corrige con un salto.
+ * - La deriva de un oscilador adelantado se estima y el desfasaje converge a cero.
+ */
+
+void setUp(void) {
+    clock = ClockCreate(CLOCK_TICK_PER_SECONDS, NULL);
+    sync = SyncCreate(&driver, clock);
+}
+
+// La primera referencia ajusta la hora y la fecha en forma inmediata.
+void test_first_reference_steps_clock(void) {
+    static const clockTimeT expected = {.time = {.hours = {2, 1}, .minutes = {0, 0}, .seconds = {0, 0}}};
+    clockTimeT time;
+    calendarDateT date;
+    syncStatsT stats;
+
+    TEST_ASSERT_NOT_NULL(sync);
+    TEST_ASSERT_TRUE(Receive("GPRMC,120000.00,A,2649.0,S,06513.0,W,0.0,0.0,150325,,,A"));
+    TEST_ASSERT_EQUAL_UINT32(TEST_REFERENCE_UTC, ClockGetUtc(clock));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, time.bcd, sizeof(clockTimeT));
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(15, date.day);
+
+    TEST_ASSERT_TRUE(SyncGetStats(sync, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.steps);
+}
+
+// Se aceptan sentencias ZDA de cualquier emisor.
+void test_zda_sentence(void) {
+    TEST_ASSERT_TRUE(Receive("GNZDA,120000.00,15,03,2025,00,00"));
+    TEST_ASSERT_EQUAL_UINT32(TEST_REFERENCE_UTC, ClockGetUtc(clock));
+}
+
+// Se descartan sentencias con suma de verificación inválida o sin posición válida.
+void test_invalid_sentences(void) {
+    syncStatsT stats;
+
+    inputLength = sprintf(input, "$GNZDA,120000.00,15,03,2025,00,00*00\r\n");
+    inputPosition = 0;
+    TEST_ASSERT_FALSE(SyncPoll(sync));
+    TEST_ASSERT_FALSE(Receive("GPRMC,120000.00,V,,,,,,,150325,,,N"));
+    TEST_ASSERT_FALSE(Receive("GPGGA,120000.00,2649.0,S,06513.0,W,1,08,0.9,450.0,M,,,,"));
+    TEST_ASSERT_FALSE(Receive("GNZDA,120000.00,30,02,2025,00,00"));
+
+    SyncGetStats(sync, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.errors);
+    TEST_ASSERT_EQUAL_UINT32(0, ClockGetUtc(clock));
+}
+
+// Las sentencias de hora con campos mal formados se cuentan como errores, las de otros tipos se ignoran.
+void test_malformed_sentences_count_errors(void) {
+    syncStatsT stats;
+
+    inputLength = sprintf(input, "GNZDA,120000.00,15,03,2025,00,00\r\n");
+    inputPosition = 0;
+    TEST_ASSERT_FALSE(SyncPoll(sync));
+    TEST_ASSERT_FALSE(Receive("GPRMC,12x000.00,A,2649.0,S,06513.0,W,0.0,0.0,150325,,,A"));
+    TEST_ASSERT_FALSE(Receive("GPRMC,120000.00,A,2649.0,S,06513.0,W,0.0,0.0,1503,,,A"));
+    TEST_ASSERT_FALSE(Receive("GNZDA,250000.00,15,03,2025,00,00"));
+    TEST_ASSERT_FALSE(Receive("GNZDA,120000.00,15,3,2025,00,00"));
+    TEST_ASSERT_FALSE(Receive("GNZDA,120000.00"));
+    TEST_ASSERT_FALSE(Receive("GPGSV,1,1,01,12,45,120,38"));
+
+    SyncGetStats(sync, &stats);
+    TEST_ASSERT_EQUAL_UINT32(6, stats.errors);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(0, ClockGetUtc(clock));
+}
+
+// Un desfasaje pequeño se corrige variando la frecuencia, sin saltos en la hora.
+void test_small_offset_is_slewed(void) {
+    syncStatsT stats;
+
+    Receive("GNZDA,120000.00,15,03,2025,00,00");
+    Run(CLOCK_TICK_PER_SECONDS - 500); // El reloj está 50 ms atrasado respecto de la referencia
+    Receive("GNZDA,120001.00,15,03,2025,00,00");
+
+    SyncGetStats(sync, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.steps);
+    TEST_ASSERT_INT32_WITHIN(1, 50000, stats.offset);
+    TEST_ASSERT_EQUAL_INT32(SYNC_MAX_TRIM, stats.trim); // La corrección de frecuencia está acotada
+    TEST_ASSERT_EQUAL_UINT32(TEST_REFERENCE_UTC, ClockGetUtc(clock));
+
+    Run(CLOCK_TICK_PER_SECONDS);
+    TEST_ASSERT_EQUAL_UINT32(TEST_REFERENCE_UTC + 1, ClockGetUtc(clock)); // El reloj corre más rápido pero sin saltar
+}
+
+// Un desfasaje grande luego de sincronizar se corrige con un salto.
+void test_large_offset_is_stepped(void) {
+    syncStatsT stats;
+
+    Receive("GNZDA,120000.00,15,03,2025,00,00");
+    Run(CLOCK_TICK_PER_SECONDS);
+    Receive("GNZDA,120005.00,15,03,2025,00,00");
+
+    SyncGetStats(sync, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.steps);
+    TEST_ASSERT_EQUAL_UINT32(TEST_REFERENCE_UTC + 5, ClockGetUtc(clock));
+}
+
+// La deriva de un oscilador adelantado se estima y el desfasaje converge a cero.
+void test_drift_estimation(void) {
+    char sentence[48];
+    uint32_t utc = 120000;
+    syncStatsT stats;
+
+    Receive("GNZDA,120000.00,15,03,2025,00,00");
+    for (uint32_t second = 1; second <= 1200; second++) {
+        // El oscilador funciona 100 ppm más rápido que la frecuencia nominal
+        Run(CLOCK_TICK_PER_SECONDS + CLOCK_TICK_PER_SECONDS / 10000);
+        utc = 120000 + (second / 3600) * 10000 + ((second / 60) % 60) * 100 + second % 60;
+        sprintf(sentence, "GNZDA,%06lu.00,15,03,2025,00,00", (unsigned long)utc);
+        TEST_ASSERT_TRUE(Receive(sentence));
+    }
+
+    SyncGetStats(sync, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.steps);
+    TEST_ASSERT_INT32_WITHIN(5000, -100000, stats.drift);
+    TEST_ASSERT_INT32_WITHIN(200, 0, stats.offset);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_timezone.c
+ ** @brief Archivo de pruebas unitarias para las zonas horarias.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "timezone.h"
+#include "calendar.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define HOUR (3600L)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Obtiene el instante UTC correspondiente a una fecha y hora UTC.
+ *
+ * @param year  Año.
+ * @param month  Mes, de 1 a 12.
+ * @param day  Día del mes.
+ * @param hour  Hora UTC.
+ * @return uint32_t Segundos UTC desde la época.
+ */
+static uint32_t UtcInstant(uint16_t year, uint8_t month, uint8_t day, uint8_t hour);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t UtcInstant(uint16_t year, uint8_t month, uint8_t day, uint8_t hour) {
+    return CalendarToDays(&(calendarDateT){.year = year, .month = month, .day = day}) * 86400UL + hour * HOUR;
+}
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Una zona sin horario de verano tiene un desplazamiento fijo y ninguna transición.
+ * - Una zona del hemisferio norte calcula el inicio y el fin del horario de verano.
+ * - Una zona del hemisferio sur calcula el horario de verano que cruza el cambio de año.
+ * - Rechazar descripciones invalidas.
+ * - La zona conserva su descripción para poder guardarla.
+ */
+
+void setUp(void) {
+}
+
+// Una zona sin horario de verano tiene un desplazamiento fijo y ninguna transición.
+void test_fixed_offset_zone(void) {
+    uint32_t next = 0;
+    timezoneT zone = TimezoneCreate("ART3");
+
+    TEST_ASSERT_NOT_NULL(zone);
+    TEST_ASSERT_EQUAL_INT32(-3 * HOUR, TimezoneOffset(zone, UtcInstant(2025, 6, 1, 0), &next));
+    TEST_ASSERT_EQUAL_UINT32(TIMEZONE_NO_TRANSITION, next);
+    TEST_ASSERT_EQUAL_INT32(5 * HOUR + 1800, TimezoneOffset(TimezoneCreate("<+0530>-5:30"), 0, NULL));
+}
+
+// Una zona del hemisferio norte calcula el inicio y el fin del horario de verano.
+void test_northern_daylight_zone(void) {
+    uint32_t next = 0;
+    timezoneT zone = TimezoneCreate("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    TEST_ASSERT_NOT_NULL(zone);
+    TEST_ASSERT_EQUAL_INT32(HOUR, TimezoneOffset(zone, UtcInstant(2025, 1, 15, 12), &next));
+    TEST_ASSERT_EQUAL_UINT32(UtcInstant(2025, 3, 30, 1), next);
+    TEST_ASSERT_EQUAL_INT32(2 * HOUR, TimezoneOffset(zone, next, &next));
+    TEST_ASSERT_EQUAL_UINT32(UtcInstant(2025, 10, 26, 1), next);
+    TEST_ASSERT_EQUAL_INT32(HOUR, TimezoneOffset(zone, next, &next));
+    TEST_ASSERT_EQUAL_UINT32(UtcInstant(2026, 3, 29, 1), next);
+}
+
+// Una zona del hemisferio sur calcula el horario de verano que cruza el cambio de año.
+void test_southern_daylight_zone(void) {
+    uint32_t next = 0;
+    timezoneT zone = TimezoneCreate("AEST-10AEDT,M10.1.0,M4.1.0/3");
+
+    TEST_ASSERT_NOT_NULL(zone);
+    TEST_ASSERT_EQUAL_INT32(11 * HOUR, TimezoneOffset(zone, UtcInstant(2025, 1, 1, 0), &next));
+    TEST_ASSERT_EQUAL_UINT32(UtcInstant(2025, 4, 5, 16), next); // 2025-04-06 03:00 AEDT
+    TEST_ASSERT_EQUAL_INT32(10 * HOUR, TimezoneOffset(zone, next, &next));
+    TEST_ASSERT_EQUAL_UINT32(UtcInstant(2025, 10, 4, 16), next); // 2025-10-05 02:00 AEST
+}
+
+// Rechazar descripciones invalidas.
+void test_invalid_descriptions(void) {
+    TEST_ASSERT_NULL(TimezoneCreate(NULL));
+    TEST_ASSERT_NULL(TimezoneCreate(""));
+    TEST_ASSERT_NULL(TimezoneCreate("AR3"));
+    TEST_ASSERT_NULL(TimezoneCreate("CET-1CEST"));
+    TEST_ASSERT_NULL(TimezoneCreate("CET-1CEST,J60,J300"));
+    TEST_ASSERT_NULL(TimezoneCreate("CET-1CEST,M13.5.0,M10.5.0"));
+    TEST_ASSERT_NULL(TimezoneCreate("<LONGNAME>-1<LONGNAMEDST>,M3.5.0,M10.5.0/3"));
+}
+
+// La zona conserva su descripción para poder guardarla.
+void test_description(void) {
+    timezoneT zone = TimezoneCreate("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    TEST_ASSERT_EQUAL_STRING("CET-1CEST,M3.5.0,M10.5.0/3", TimezoneGetDescription(zone));
+    TEST_ASSERT_NULL(TimezoneGetDescription(NULL));
+    TimezoneDestroy(zone);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,147 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Gustavo Leonel Juarez <leonellj01@gmail.com>
+Copyright (c) 2025, Laboratorio de microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_trace.c
+ ** @brief Archivo de pruebas unitarias para el registro binario de eventos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "trace.h"
+#include "trace_decoder.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Testing functions =========================================================================================== */
+
+/**
+ * - Cada registro ocupa ocho bytes.
+ * - Sin eventos no hay registros para leer.
+ * - Los eventos se leen en orden con su marca de tiempo.
+ * - La lectura continúa desde el cursor.
+ * - Al llenarse el buffer se conservan los eventos más nuevos.
+ * - El decodificador interpreta las líneas del volcado y las describe.
+ */
+
+void setUp(void) {
+    now = 0;
+    TraceInit(&now);
+}
+
+// Cada registro ocupa ocho bytes.
+void test_record_size(void) {
+    TEST_ASSERT_EQUAL(8, sizeof(traceRecordT));
+}
+
+// Sin eventos no hay registros para leer.
+void test_empty_trace(void) {
+    traceRecordT record;
+    uint32_t cursor = 0;
+
+    TEST_ASSERT_EQUAL_UINT16(0, TraceRead(&cursor, &record, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, cursor);
+}
+
+// Los eventos se leen en orden con su marca de tiempo.
+void test_read_events_in_order(void) {
+    traceRecordT records[4];
+    uint32_t cursor = 0;
+
+    now = 100;
+    TraceRecord(TRACE_MODE, 1);
+    now = 250;
+    TraceRecord(TRACE_SET_TIME, 0x1230);
+    TraceRecord(TRACE_ALARM_RING, 0);
+
+    TEST_ASSERT_EQUAL_UINT16(3, TraceRead(&cursor, records, 4));
+    TEST_ASSERT_EQUAL_UINT32(100, records[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_MODE, records[0].event);
+    TEST_ASSERT_EQUAL_UINT16(1, records[0].data);
+    TEST_ASSERT_EQUAL_UINT32(250, records[1].timestamp);
+    TEST_ASSERT_EQUAL_UINT16(0x1230, records[1].data);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ALARM_RING, records[2].event);
+}
+
+// La lectura continúa desde el cursor.
+void test_read_continues_from_cursor(void) {
+    traceRecordT record;
+    uint32_t cursor = 0;
+
+    TraceRecord(TRACE_KEY, TRACE_KEY_SET_TIME);
+    TraceRecord(TRACE_KEY, TRACE_KEY_INCREMENT);
+    TEST_ASSERT_EQUAL_UINT16(1, TraceRead(&cursor, &record, 1));
+    TEST_ASSERT_EQUAL_UINT16(TRACE_KEY_SET_TIME, record.data);
+
+    TraceRecord(TRACE_KEY, TRACE_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL_UINT16(1, TraceRead(&cursor, &record, 1));
+    TEST_ASSERT_EQUAL_UINT16(TRACE_KEY_INCREMENT, record.data);
+    TEST_ASSERT_EQUAL_UINT16(1, TraceRead(&cursor, &record, 1));
+    TEST_ASSERT_EQUAL_UINT16(TRACE_KEY_ACCEPT, record.data);
+    TEST_ASSERT_EQUAL_UINT16(0, TraceRead(&cursor, &record, 1));
+}
+
+// Al llenarse el buffer se conservan los eventos más nuevos.
+void test_overflow_keeps_newest(void) {
+    traceRecordT records[TRACE_SIZE];
+    uint32_t cursor = 0;
+
+    for (uint16_t index = 0; index < TRACE_SIZE + 10; index++) {
+        now = index;
+        TraceRecord(TRACE_MODE, index);
+    }
+    TEST_ASSERT_EQUAL_UINT16(TRACE_SIZE, TraceRead(&cursor, records, TRACE_SIZE));
+    TEST_ASSERT_EQUAL_UINT16(10, records[0].data);
+    TEST_ASSERT_EQUAL_UINT16(TRACE_SIZE + 9, records[TRACE_SIZE - 1].data);
+    TEST_ASSERT_EQUAL_UINT32(TRACE_SIZE + 10, cursor);
+}
+
+// El decodificador interpreta las líneas del volcado y las describe.
+void test_decoder(void) {
+    traceRecordT record;
+    char text[40];
+
+    TEST_ASSERT_TRUE(TraceDecoderParse("trace 0000303A 01 0004\r\n", &record));
+    TEST_ASSERT_EQUAL_UINT32(12346, record.timestamp);
+    TraceDecoderFormat(&record, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("12.346 key accept", text);
+
+    TEST_ASSERT_TRUE(TraceDecoderParse("trace 00000064 07 0730", &record));
+    TraceDecoderFormat(&record, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("0.100 set alarm 07:30", text);
+
+    TEST_ASSERT_FALSE(TraceDecoderParse("trace end", &record));
+    TEST_ASSERT_FALSE(TraceDecoderParse("time 12:00:00", &record));
+}
+
+/* === End of documentation ======================================================================================== */